@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <functional> // TODO: Is std::less constexpr?
 #include "cexpr/detail/basic_list.hpp"
+#include "cexpr/detail/basic_tree.hpp"
 
 namespace cexpr {
 
@@ -19,6 +20,119 @@ constexpr Container sort(Container const& container);
 template<class Container, class Compare>
 constexpr Container sort(Container const& container, Compare cmp);
 
+/*!
+ * Returns the position of the first element in \p container equal to \p value, or its size if there is none.
+ */
+template<class Container>
+constexpr typename Container::size_type find(Container const& container, typename Container::value_type const& value);
+
+/*!
+ * Returns the number of elements in \p container equal to \p value.
+ */
+template<class Container>
+constexpr typename Container::size_type count(Container const& container, typename Container::value_type const& value);
+
+/*!
+ * Returns the smallest element in \p container.
+ * \details The elements are reduced in the order described by detail::reduce.
+ */
+template<class Container>
+constexpr typename Container::value_type min(Container const& container);
+
+/*!
+ * Returns the largest element in \p container.
+ * \details The elements are reduced in the order described by detail::reduce.
+ */
+template<class Container>
+constexpr typename Container::value_type max(Container const& container);
+
+/*!
+ * Returns the sum of the elements in \p container.
+ * \details The elements are reduced in the order described by detail::reduce.
+ */
+template<class Container>
+constexpr typename Container::value_type sum(Container const& container);
+
+template<typename T, std::size_t N>
+constexpr detail::basic_list<T, N> sort(detail::basic_list<T, N> const& list);
+
+/*!
+ * Returns the permutation of the positions in \p list that sorts it using <=.
+ */
+template<typename Index = std::size_t, typename T, std::size_t N>
+constexpr detail::basic_list<Index, N> sort_indices(detail::basic_list<T, N> const& list);
+
+/*!
+ * Returns the permutation of the positions in \p list that sorts it using \p cmp.
+ * \details The elements are copied once into a detail::basic_tree that the comparisons read in O(log N)
+ * calls, and only the positions are moved while sorting.  \p Index may be narrower than \c std::size_t
+ * provided it can represent \p N - 1.
+ */
+template<typename Index = std::size_t, typename T, std::size_t N, class Compare>
+constexpr detail::basic_list<Index, N> sort_indices(detail::basic_list<T, N> const& list, Compare cmp);
+
+/*!
+ * Returns the elements list[permutation[0]], list[permutation[1]], ...
+ * \details Neither \p list nor \p permutation is copied; each element is read from \p list once.
+ */
+template<typename T, std::size_t N, typename Index>
+constexpr detail::basic_list<T, N> apply_permutation(detail::basic_list<T, N> const& list, detail::basic_list<Index, N> const& permutation);
+
+namespace detail {
+
+//! The total size of lists of sizes \p N...
+template<std::size_t... N>
+struct total_size;
+
+template<>
+struct total_size<> {
+	static constexpr std::size_t value = 0;
+};
+
+template<std::size_t N, std::size_t... M>
+struct total_size<N, M...> {
+	static constexpr std::size_t value = N + total_size<M...>::value;
+};
+
+//! The type of chain_lists(lists...).
+template<class... Lists>
+struct list_chain;
+
+template<>
+struct list_chain<> {
+	typedef basic_range_chain_end type;
+};
+
+template<typename T, std::size_t N, class... Lists>
+struct list_chain<basic_list<T, N>, Lists...> {
+	typedef basic_range_chain<typename basic_list<T, N>::const_iterator, typename list_chain<Lists...>::type> type;
+};
+
+constexpr basic_range_chain_end chain_lists() {
+	return {};
+}
+
+//! Chains the elements of \p list ++ \p lists...
+template<typename T, std::size_t N, class... Lists>
+constexpr typename list_chain<basic_list<T, N>, Lists...>::type chain_lists(basic_list<T, N> const& list, Lists const&... lists) {
+	return { list.cbegin(), list.cend(), chain_lists(lists...) };
+}
+
+}
+
+/*!
+ * Returns the elements of \p lists one after another.
+ * \details Constructs the result in a single pass rather than one rebuild per list.
+ */
+template<typename T, std::size_t... N>
+constexpr detail::basic_list<T, detail::total_size<N...>::value> concat(detail::basic_list<T, N> const&... lists) {
+	return detail::basic_list<T, detail::total_size<N...>::value>(
+		detail::chain_lists(lists...));
+}
+
+template<typename T, std::size_t N, class Compare>
+constexpr detail::basic_list<T, N> sort(detail::basic_list<T, N> const& list, Compare cmp);
+
 namespace detail {
 
 /*
@@ -40,11 +154,11 @@ constexpr basic_list<T, N+M> merge(basic_list<T, N> list1, basic_list<T, M> list
 			? basic_list<T, N+M>(merge(
 				basic_list<T, (N > 0 ? N-1 : 0)>(list1.begin() + 1, list1.end()),
 				list2,
-				cmp).insert(0, list1[0])
+				cmp)).insert(0, list1[0])
 			: basic_list<T, N+M>(merge(
 				list1,
 				basic_list<T, (M > 0 ? M-1 : 0)>(list2.begin() + 1, list2.end()),
-				cmp).insert(0, list2[0])
+				cmp)).insert(0, list2[0])
 		: N > 0
 			? basic_list<T, N+M>(list1)  // HINT: N+M == N
 			: basic_list<T, N+M>(list2); // HINT: N+M == M
@@ -52,24 +166,215 @@ constexpr basic_list<T, N+M> merge(basic_list<T, N> list1, basic_list<T, M> list
 
 template<typename T, std::size_t N, std::size_t M, class Compare>
 constexpr basic_list<T, N+M> sort(basic_list<T, N> list1, basic_list<T, M> list2, Compare cmp) {
-	return merge(sort(list1, cmp), sort(list2, cmp), cmp);
+	return merge(cexpr::sort(list1, cmp), cexpr::sort(list2, cmp), cmp);
+}
+
+//! \c constexpr iterator over the positions \p position, \p position + 1, ...
+template<typename Index>
+class basic_index_iterator {
+public:
+	constexpr explicit basic_index_iterator(std::size_t position)
+		: position(position)
+		{}
+
+	//! Advances forwards \p pos positions.
+	constexpr basic_index_iterator operator+(std::size_t pos) {
+		return basic_index_iterator(position + pos);
+	}
+
+	constexpr Index operator*() {
+		return static_cast<Index>(position);
+	}
+
+	friend constexpr bool operator==(basic_index_iterator lhs, basic_index_iterator rhs) {
+		return lhs.position == rhs.position;
+	}
+
+	friend constexpr bool operator!=(basic_index_iterator lhs, basic_index_iterator rhs) {
+		return !(lhs == rhs);
+	}
+
+private:
+	std::size_t position;
+};
+
+//! \c constexpr iterator over list[permutation[position]], list[permutation[position + 1]], ...
+//! \warning Refers to \p list and \p permutation, which must outlive it.
+template<typename T, std::size_t N, typename Index>
+class basic_permutation_iterator {
+public:
+	constexpr basic_permutation_iterator(basic_list<T, N> const& list, basic_list<Index, N> const& permutation, std::size_t position)
+		: list(&list)
+		, permutation(&permutation)
+		, position(position)
+		{}
+
+	//! Advances forwards \p pos positions.
+	constexpr basic_permutation_iterator operator+(std::size_t pos) {
+		return { *list, *permutation, position + pos };
+	}
+
+	//! \warning Recurses permutation[position] + position times.
+	constexpr T operator*() {
+		return (*list)[(*permutation)[position]];
+	}
+
+	friend constexpr bool operator==(basic_permutation_iterator lhs, basic_permutation_iterator rhs) {
+		return lhs.position == rhs.position;
+	}
+
+	friend constexpr bool operator!=(basic_permutation_iterator lhs, basic_permutation_iterator rhs) {
+		return !(lhs == rhs);
+	}
+
+private:
+	basic_list<T, N> const* list;
+	basic_list<Index, N> const* permutation;
+	std::size_t position;
+};
+
+//! Compares positions in \p records by comparing the elements at them with \p cmp.
+//! \warning Refers to \p records, which must outlive it.
+template<typename T, std::size_t N, class Compare>
+class index_compare {
+public:
+	constexpr index_compare(basic_tree<T, N> const& records, Compare cmp)
+		: records(&records)
+		, cmp(cmp)
+		{}
+
+	template<typename Index>
+	constexpr bool operator()(Index lhs, Index rhs) {
+		return cmp((*records)[lhs], (*records)[rhs]);
+	}
+
+private:
+	basic_tree<T, N> const* records;
+	Compare cmp;
+};
+
+template<typename Index, typename T, std::size_t N, class Compare>
+constexpr basic_list<Index, N> sort_indices(basic_tree<T, N> const& records, Compare cmp) {
+	return cexpr::sort(basic_list<Index, N>(basic_index_iterator<Index>(0), basic_index_iterator<Index>(N)),
+	                   index_compare<T, N, Compare>(records, cmp));
+}
+
+//! Number of interleaved accumulators used by reduce.
+//! \details Matches the width of the vector kernels in cexpr/runtime/algorithm.hpp so that they produce
+//! identical results, including for floating-point elements.
+constexpr std::size_t reduce_lanes = 8;
+
+template<typename T>
+struct minimum {
+	constexpr T operator()(T const& lhs, T const& rhs) const { return lhs < rhs ? lhs : rhs; }
+};
+
+template<typename T>
+struct maximum {
+	constexpr T operator()(T const& lhs, T const& rhs) const { return lhs > rhs ? lhs : rhs; }
+};
+
+template<typename T>
+struct plus {
+	constexpr T operator()(T const& lhs, T const& rhs) const { return lhs + rhs; }
+};
+
+template<typename T, std::size_t N, class Operation>
+constexpr T reduce_lane(basic_list<T, N> const& list, std::size_t pos, T const& acc, Operation op) {
+	return pos < N
+		? reduce_lane(list, pos + reduce_lanes, op(acc, list[pos]), op)
+		: acc;
+}
+
+template<typename T, std::size_t N, class Operation>
+constexpr T reduce_lanes_from(basic_list<T, N> const& list, std::size_t lane, T const& acc, Operation op) {
+	return lane < reduce_lanes && lane < N
+		? reduce_lanes_from(list, lane + 1, op(acc, reduce_lane(list, lane + reduce_lanes, list[lane], op)), op)
+		: acc;
+}
+
+/*
+ * for (j = 0; j < min(N, reduce_lanes); ++j)
+ *     lane[j] = list[j]
+ * for (i = reduce_lanes; i < N; ++i)
+ *     lane[i % reduce_lanes] = op(lane[i % reduce_lanes], list[i])
+ * return op(...op(op(lane[0], lane[1]), lane[2])..., lane[min(N, reduce_lanes) - 1])
+ */
+template<typename T, std::size_t N, class Operation>
+constexpr T reduce(basic_list<T, N> const& list, Operation op) {
+	return reduce_lanes_from(list, 1, reduce_lane(list, reduce_lanes, list[0], op), op);
 }
 
+template<typename T, std::size_t N>
+constexpr std::size_t find(basic_list<T, N> const& list, T const& value, std::size_t pos) {
+	return pos < N && !(list[pos] == value)
+		? find(list, value, pos + 1)
+		: pos;
 }
 
 template<typename T, std::size_t N>
-constexpr basic_list<T, N> sort(basic_list<T, N> const& list) {
+constexpr std::size_t count(basic_list<T, N> const& list, T const& value, std::size_t pos) {
+	return pos < N
+		? (list[pos] == value ? 1 : 0) + count(list, value, pos + 1)
+		: 0;
+}
+
+}
+
+template<typename T, std::size_t N>
+constexpr detail::basic_list<T, N> sort(detail::basic_list<T, N> const& list) {
 	return sort(list, std::less_equal<T>());
 }
 
 // TODO: Is this stable? Decide whether cexpr::sort should guarantee stability.
 template<typename T, std::size_t N, class Compare>
-constexpr basic_list<T, N> sort(basic_list<T, N> const& list, Compare cmp) {
-	return N == 1
+constexpr detail::basic_list<T, N> sort(detail::basic_list<T, N> const& list, Compare cmp) {
+	return N <= 1
 		? list
-		: sort(basic_list<T, N/2>(list.begin(), list.begin() + N/2),
-		       basic_list<T, (N+1)/2>(list.begin() + N/2, list.end()),
-		       cmp);
+		: detail::sort(detail::basic_list<T, N/2>(list.begin(), list.begin() + N/2),
+		               detail::basic_list<T, (N+1)/2>(list.begin() + N/2, list.end()),
+		               cmp);
+}
+
+template<typename Index, typename T, std::size_t N>
+constexpr detail::basic_list<Index, N> sort_indices(detail::basic_list<T, N> const& list) {
+	return sort_indices<Index>(list, std::less_equal<T>());
+}
+
+template<typename Index, typename T, std::size_t N, class Compare>
+constexpr detail::basic_list<Index, N> sort_indices(detail::basic_list<T, N> const& list, Compare cmp) {
+	return detail::sort_indices<Index>(detail::list_tree(list), cmp);
+}
+
+template<typename T, std::size_t N, typename Index>
+constexpr detail::basic_list<T, N> apply_permutation(detail::basic_list<T, N> const& list, detail::basic_list<Index, N> const& permutation) {
+	return detail::basic_list<T, N>(detail::basic_permutation_iterator<T, N, Index>(list, permutation, 0),
+	                                detail::basic_permutation_iterator<T, N, Index>(list, permutation, N));
+}
+
+template<typename T, std::size_t N>
+constexpr std::size_t find(detail::basic_list<T, N> const& list, T const& value) {
+	return detail::find(list, value, 0);
+}
+
+template<typename T, std::size_t N>
+constexpr std::size_t count(detail::basic_list<T, N> const& list, T const& value) {
+	return detail::count(list, value, 0);
+}
+
+template<typename T, std::size_t N>
+constexpr T min(detail::basic_list<T, N> const& list) {
+	return detail::reduce(list, detail::minimum<T>());
+}
+
+template<typename T, std::size_t N>
+constexpr T max(detail::basic_list<T, N> const& list) {
+	return detail::reduce(list, detail::maximum<T>());
+}
+
+template<typename T, std::size_t N>
+constexpr T sum(detail::basic_list<T, N> const& list) {
+	return detail::reduce(list, detail::plus<T>());
 }
 
 }
@@ -0,0 +1,474 @@
+/*!
+ * \file compressed_table.hpp
+ * \brief \c constexpr read-only tables compressed from a basic_list.
+ * \details block_table deduplicates fixed-size blocks behind an index (the classic two-stage lookup) and
+ * suits tables with repeated stretches such as character properties.  run_table stores piecewise-constant
+ * tables as runs behind a sampled index.  Both answer operator[] in a constant expression and lookup at
+ * runtime with exactly the values of the basic_list they were built from.
+ *
+ * Their sizes must be known before they are built, so the number of unique blocks or runs is computed
+ * first:
+ * \code
+ * constexpr cexpr::block_table<int, 256, 16, cexpr::unique_blocks<16>(list)> table(list);
+ * \endcode
+ *
+ * Elements are compared with detail::same_value, which is operator== except that 0.0 and -0.0 differ.
+ * NaNs never compare equal, so each is stored on its own.
+ */
+
+#ifndef CEXPR_COMPRESSED_TABLE_HPP
+#define CEXPR_COMPRESSED_TABLE_HPP
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include "cexpr/detail/basic_tree.hpp"
+
+namespace cexpr {
+
+namespace detail {
+
+//! Returns true if \p lhs and \p rhs are equal and so interchangeable in a table.
+template<typename T>
+constexpr bool same_value(T const& lhs, T const& rhs) {
+#ifndef __GNUC__
+	static_assert(!std::is_floating_point<T>::value, "0.0 and -0.0 cannot be told apart in a constant expression");
+#endif
+	return lhs == rhs;
+}
+
+#ifdef __GNUC__
+// HINT: 0.0 == -0.0, so the signs are compared too; the builtins fold in constant expressions.
+constexpr bool same_value(float lhs, float rhs) {
+	return lhs == rhs && __builtin_copysignf(1.0f, lhs) == __builtin_copysignf(1.0f, rhs);
+}
+
+constexpr bool same_value(double lhs, double rhs) {
+	return lhs == rhs && __builtin_copysign(1.0, lhs) == __builtin_copysign(1.0, rhs);
+}
+
+constexpr bool same_value(long double lhs, long double rhs) {
+	return lhs == rhs && __builtin_copysignl(1.0L, lhs) == __builtin_copysignl(1.0L, rhs);
+}
+#endif
+
+//! Returns true if blocks \p a and \p b of size \p B agree at offsets [ \p first, \p last ).
+//! \details Offsets past the end of \p elements are ignored so that a partial last block can share a full one.
+template<typename T, std::size_t N>
+constexpr bool blocks_equal(basic_tree<T, N> const& elements, std::size_t B, std::size_t a, std::size_t b, std::size_t first, std::size_t last) {
+	return last - first <= 1
+		? first == last || a * B + first >= N || b * B + first >= N || same_value(elements[a * B + first], elements[b * B + first])
+		: blocks_equal(elements, B, a, b, first, (first + last) / 2) && blocks_equal(elements, B, a, b, (first + last) / 2, last);
+}
+
+template<typename T, std::size_t N>
+constexpr std::size_t first_equal_block(basic_tree<T, N> const& elements, std::size_t B, std::size_t a, std::size_t first, std::size_t last);
+
+template<typename T, std::size_t N>
+constexpr std::size_t first_equal_block_or(basic_tree<T, N> const& elements, std::size_t B, std::size_t a, std::size_t first, std::size_t last, std::size_t found) {
+	return found != a
+		? found
+		: first_equal_block(elements, B, a, first, last);
+}
+
+//! Returns the first block in [ \p first, \p last ) equal to block \p a, or \p a if there is none.
+template<typename T, std::size_t N>
+constexpr std::size_t first_equal_block(basic_tree<T, N> const& elements, std::size_t B, std::size_t a, std::size_t first, std::size_t last) {
+	return last - first <= 1
+		? first < last && blocks_equal(elements, B, a, first, 0, B) ? first : a
+		: first_equal_block_or(elements, B, a, (first + last) / 2, last, first_equal_block(elements, B, a, first, (first + last) / 2));
+}
+
+//! Returns the number of blocks in [ \p first, \p last ) that are not equal to an earlier block.
+template<std::size_t K>
+constexpr std::size_t count_unique_blocks(basic_tree<std::size_t, K> const& firsts, std::size_t first, std::size_t last) {
+	return last - first <= 1
+		? first < last && firsts[first] == first ? 1 : 0
+		: count_unique_blocks(firsts, first, (first + last) / 2) + count_unique_blocks(firsts, (first + last) / 2, last);
+}
+
+/*
+ * The first block in [first, last) with more than u unique blocks up to and including it, which is the
+ * unique block numbered u.
+ */
+template<std::size_t K>
+constexpr std::size_t unique_block(basic_tree<std::size_t, K> const& firsts, basic_tree<std::size_t, K> const& ranks, std::size_t u, std::size_t first, std::size_t last) {
+	return last - first <= 1
+		? first
+		: ranks[(first + last) / 2 - 1] + (firsts[(first + last) / 2 - 1] == (first + last) / 2 - 1 ? 1 : 0) > u
+			? unique_block(firsts, ranks, u, first, (first + last) / 2)
+			: unique_block(firsts, ranks, u, (first + last) / 2, last);
+}
+
+//! Generates the first block equal to each block.
+template<typename T, std::size_t N, std::size_t B>
+class first_equal_blocks {
+public:
+	constexpr explicit first_equal_blocks(basic_tree<T, N> const& elements)
+		: elements(elements)
+		{}
+
+	constexpr std::size_t operator()(std::size_t a) {
+		return first_equal_block(elements, B, a, 0, a);
+	}
+
+private:
+	basic_tree<T, N> elements;
+};
+
+//! Generates the number of unique blocks before each block.
+template<std::size_t K>
+class unique_block_ranks {
+public:
+	constexpr explicit unique_block_ranks(basic_tree<std::size_t, K> const& firsts)
+		: firsts(firsts)
+		{}
+
+	constexpr std::size_t operator()(std::size_t a) {
+		return count_unique_blocks(firsts, 0, a);
+	}
+
+private:
+	basic_tree<std::size_t, K> firsts;
+};
+
+//! Splits \p N elements into blocks of \p B and numbers the unique blocks in order of appearance.
+//! \warning Compares every block with every earlier block, O(N^2 / B) comparisons.
+template<typename T, std::size_t N, std::size_t B>
+class block_dedup {
+public:
+	static constexpr std::size_t block_count = (N + B - 1) / B;
+
+	constexpr explicit block_dedup(basic_list<T, N> const& list)
+		: block_dedup(list_tree(list))
+		{}
+
+	//! Returns the number of unique blocks.
+	constexpr std::size_t unique() {
+		return count_unique_blocks(firsts, 0, block_count);
+	}
+
+	//! Returns the number of the unique block equal to block \p a.
+	constexpr std::size_t index(std::size_t a) {
+		return ranks[firsts[a]];
+	}
+
+	//! Returns element \p pos of the unique blocks laid end to end, padding the last block with T().
+	constexpr T element(std::size_t pos) {
+		return unique_block(firsts, ranks, pos / B, 0, block_count) * B + pos % B < N
+			? elements[unique_block(firsts, ranks, pos / B, 0, block_count) * B + pos % B]
+			: T();
+	}
+
+private:
+	constexpr explicit block_dedup(basic_tree<T, N> const& elements)
+		: block_dedup(elements, basic_tree<std::size_t, block_count>(first_equal_blocks<T, N, B>(elements), 0))
+		{}
+
+	constexpr block_dedup(basic_tree<T, N> const& elements, basic_tree<std::size_t, block_count> const& firsts)
+		: elements(elements)
+		, firsts(firsts)
+		, ranks(unique_block_ranks<block_count>(firsts), 0)
+		{}
+
+	basic_tree<T, N> elements;
+	basic_tree<std::size_t, block_count> firsts;
+	basic_tree<std::size_t, block_count> ranks;
+};
+
+template<typename T, std::size_t N, std::size_t B, typename Index>
+class block_indices {
+public:
+	constexpr explicit block_indices(block_dedup<T, N, B> const& dedup)
+		: dedup(dedup)
+		{}
+
+	constexpr Index operator()(std::size_t a) {
+		return Index(dedup.index(a));
+	}
+
+private:
+	block_dedup<T, N, B> dedup;
+};
+
+template<typename T, std::size_t N, std::size_t B>
+class block_elements {
+public:
+	constexpr explicit block_elements(block_dedup<T, N, B> const& dedup)
+		: dedup(dedup)
+		{}
+
+	constexpr T operator()(std::size_t pos) {
+		return dedup.element(pos);
+	}
+
+private:
+	block_dedup<T, N, B> dedup;
+};
+
+template<typename T, std::size_t N>
+constexpr bool run_starts_at(basic_tree<T, N> const& elements, std::size_t pos) {
+	return pos == 0 || !same_value(elements[pos], elements[pos - 1]);
+}
+
+//! Returns the number of runs that start in [ \p first, \p last ).
+template<typename T, std::size_t N>
+constexpr std::size_t count_run_starts(basic_tree<T, N> const& elements, std::size_t first, std::size_t last) {
+	return last - first <= 1
+		? first < last && run_starts_at(elements, first) ? 1 : 0
+		: count_run_starts(elements, first, (first + last) / 2) + count_run_starts(elements, (first + last) / 2, last);
+}
+
+template<typename T, std::size_t N>
+constexpr std::size_t run_start(basic_tree<T, N> const& elements, std::size_t r, std::size_t first, std::size_t last);
+
+template<typename T, std::size_t N>
+constexpr std::size_t run_start_split(basic_tree<T, N> const& elements, std::size_t r, std::size_t first, std::size_t last, std::size_t left) {
+	return r < left
+		? run_start(elements, r, first, (first + last) / 2)
+		: run_start(elements, r - left, (first + last) / 2, last);
+}
+
+//! Returns the start of run \p r of those that start in [ \p first, \p last ).
+//! \warning Counts the run starts of each half on the way down, O(N) comparisons.
+template<typename T, std::size_t N>
+constexpr std::size_t run_start(basic_tree<T, N> const& elements, std::size_t r, std::size_t first, std::size_t last) {
+	return last - first <= 1
+		? first
+		: run_start_split(elements, r, first, last, count_run_starts(elements, first, (first + last) / 2));
+}
+
+template<typename T, std::size_t N, typename Index>
+class run_starts {
+public:
+	constexpr explicit run_starts(basic_tree<T, N> const& elements)
+		: elements(elements)
+		{}
+
+	constexpr Index operator()(std::size_t r) {
+		return Index(run_start(elements, r, 0, N));
+	}
+
+private:
+	basic_tree<T, N> elements;
+};
+
+template<typename T, std::size_t N>
+class run_values {
+public:
+	constexpr explicit run_values(basic_tree<T, N> const& elements)
+		: elements(elements)
+		{}
+
+	constexpr T operator()(std::size_t r) {
+		return elements[run_start(elements, r, 0, N)];
+	}
+
+private:
+	basic_tree<T, N> elements;
+};
+
+//! Generates the run containing every \p S th element.
+template<typename T, std::size_t N, std::size_t S, typename Index>
+class run_samples {
+public:
+	constexpr explicit run_samples(basic_tree<T, N> const& elements)
+		: elements(elements)
+		{}
+
+	constexpr Index operator()(std::size_t k) {
+		return Index(count_run_starts(elements, 0, k * S + 1) - 1);
+	}
+
+private:
+	basic_tree<T, N> elements;
+};
+
+}
+
+//! Returns the number of unique blocks of \p B elements in \p list, the \p U of a block_table.
+template<std::size_t B, typename T, std::size_t N>
+constexpr std::size_t unique_blocks(detail::basic_list<T, N> const& list) {
+	return detail::block_dedup<T, N, B>(list).unique();
+}
+
+//! Returns the number of runs of equal elements in \p list, the \p R of a run_table.
+template<typename T, std::size_t N>
+constexpr std::size_t count_runs(detail::basic_list<T, N> const& list) {
+	return detail::count_run_starts(detail::list_tree(list), 0, N);
+}
+
+//! \c constexpr table of \p N elements stored as \p U unique blocks of \p B elements and an index of blocks.
+//! \details Takes ceil(N / B) indices plus U * B elements instead of N elements.  Reading an element costs
+//! two loads at runtime.  \p Index should be the smallest unsigned type that holds U - 1.
+template<typename T, std::size_t N, std::size_t B, std::size_t U, typename Index = std::size_t>
+class block_table {
+	static_assert(B > 0, "blocks must not be empty");
+	static_assert(U <= (N + B - 1) / B, "more unique blocks than blocks");
+	static_assert(U == 0 || U - 1 <= std::numeric_limits<Index>::max(), "Index cannot number the unique blocks");
+
+public:
+	typedef T value_type;
+	typedef std::size_t size_type;
+	typedef Index index_type;
+
+	static constexpr size_type block_size = B;
+	static constexpr size_type block_count = (N + B - 1) / B;
+	static constexpr size_type unique_block_count = U;
+
+	//! Compresses \p list.
+	//! \details Fails to compile unless \p U is unique_blocks<B>(list).
+	//! \warning Costs O(N^2) invocations to read \p list and O(N^2 / B) comparisons to find equal blocks.
+	constexpr explicit block_table(detail::basic_list<T, N> const& list)
+		: block_table(detail::block_dedup<T, N, B>(list))
+		{}
+
+	//! Returns the element at \p pos.
+	//! \warning Recurses O(log N) times.
+	constexpr T operator[](size_type pos) {
+		return pos < N
+			? blocks[std::size_t(indices[pos / B]) * B + pos % B]
+			: (fail(), T());
+	}
+
+	//! Returns the element at \p pos for use at runtime.
+	//! \details Only available for arithmetic \p T and \p Index.
+	T lookup(size_type pos) const {
+		return blocks.data()[std::size_t(indices.data()[pos / B]) * B + pos % B];
+	}
+
+	//! Returns the number of elements.
+	constexpr size_type size() {
+		return N;
+	}
+
+	//! Returns the number of the unique block holding each block, block_count of them.
+	Index const* index_data() const {
+		return indices.data();
+	}
+
+	//! Returns the unique blocks laid end to end, unique_block_count * block_size elements.
+	T const* block_data() const {
+		return blocks.data();
+	}
+
+private:
+	constexpr explicit block_table(detail::block_dedup<T, N, B> const& dedup)
+		: indices(detail::block_indices<T, N, B, Index>(dedup), 0)
+		, blocks(dedup.unique() == U
+			? detail::basic_tree<T, U * B>(detail::block_elements<T, N, B>(dedup), 0)
+			: (fail(), detail::basic_tree<T, U * B>()))
+		{}
+
+	// TODO: More descript error messages.
+	constexpr int fail() { return throw "attempt to access outside of table or U is not the number of unique blocks", 0; }
+
+	detail::basic_tree<Index, (N + B - 1) / B> indices;
+	detail::basic_tree<T, U * B> blocks;
+};
+
+//! \c constexpr table of \p N elements stored as \p R runs of equal elements.
+//! \details Takes R starts and values plus ceil(N / S) samples instead of N elements.  Each sample holds the
+//! run containing every \p S th element, so reading an element binary searches only the runs between two
+//! samples.  \p Index should be the smallest unsigned type that holds N - 1.
+template<typename T, std::size_t N, std::size_t R, std::size_t S = 64, typename Index = std::size_t>
+class run_table {
+	static_assert(S > 0, "samples must be at least one element apart");
+	static_assert(R <= N && (R > 0 || N == 0), "there must be between one and N runs");
+	static_assert(N == 0 || N - 1 <= std::numeric_limits<Index>::max(), "Index cannot hold the positions");
+
+public:
+	typedef T value_type;
+	typedef std::size_t size_type;
+	typedef Index index_type;
+
+	static constexpr size_type run_count = R;
+	static constexpr size_type sample_distance = S;
+	static constexpr size_type sample_count = (N + S - 1) / S;
+
+	//! Compresses \p list.
+	//! \details Fails to compile unless \p R is count_runs(list).
+	//! \warning Costs O(N^2) invocations to read \p list and O((R + N / S) * N) comparisons to find the runs.
+	constexpr explicit run_table(detail::basic_list<T, N> const& list)
+		: run_table(detail::list_tree(list))
+		{}
+
+	//! Returns the element at \p pos.
+	//! \warning Recurses O(log N) times.
+	constexpr T operator[](size_type pos) {
+		return pos < N
+			? values[run(pos, samples[pos / S], last_run(pos / S))]
+			: (fail(), T());
+	}
+
+	//! Returns the element at \p pos for use at runtime.
+	//! \details Only available for arithmetic \p T and \p Index.
+	T lookup(size_type pos) const {
+		size_type first = samples.data()[pos / S];
+		size_type last = pos / S + 1 < sample_count ? samples.data()[pos / S + 1] : R - 1;
+		while (first != last) {
+			size_type middle = (first + last + 1) / 2;
+			if (std::size_t(starts.data()[middle]) <= pos)
+				first = middle;
+			else
+				last = middle - 1;
+		}
+		return values.data()[first];
+	}
+
+	//! Returns the number of elements.
+	constexpr size_type size() {
+		return N;
+	}
+
+	//! Returns the position of the first element of each run, run_count of them.
+	Index const* start_data() const {
+		return starts.data();
+	}
+
+	//! Returns the value of each run, run_count of them.
+	T const* value_data() const {
+		return values.data();
+	}
+
+	//! Returns the run containing every sample_distance th element, sample_count of them.
+	Index const* sample_data() const {
+		return samples.data();
+	}
+
+private:
+	constexpr explicit run_table(detail::basic_tree<T, N> const& elements)
+		: starts(detail::count_run_starts(elements, 0, N) == R
+			? detail::basic_tree<Index, R>(detail::run_starts<T, N, Index>(elements), 0)
+			: (fail(), detail::basic_tree<Index, R>()))
+		, values(detail::run_values<T, N>(elements), 0)
+		, samples(detail::run_samples<T, N, S, Index>(elements), 0)
+		{}
+
+	//! Returns the last run in [ \p first, \p last ] that starts at or before \p pos.
+	constexpr size_type run(size_type pos, size_type first, size_type last) {
+		return first == last
+			? first
+			: std::size_t(starts[(first + last + 1) / 2]) <= pos
+				? run(pos, (first + last + 1) / 2, last)
+				: run(pos, first, (first + last + 1) / 2 - 1);
+	}
+
+	//! Returns the run containing the element before sample \p k + 1.
+	constexpr size_type last_run(size_type k) {
+		return k + 1 < sample_count
+			? samples[k + 1]
+			: R - 1;
+	}
+
+	// TODO: More descript error messages.
+	constexpr int fail() { return throw "attempt to access outside of table or R is not the number of runs", 0; }
+
+	detail::basic_tree<Index, R> starts;
+	detail::basic_tree<T, R> values;
+	detail::basic_tree<Index, (N + S - 1) / S> samples;
+};
+
+}
+
+#endif
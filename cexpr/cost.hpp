@@ -0,0 +1,204 @@
+/*!
+ * \file cost.hpp
+ * \brief Worst-case compile-time cost of the \c constexpr containers and algorithms.
+ * \details Opt-in: nothing else includes this header.  Every figure is an upper bound for the operation
+ * evaluated on its own in a constant expression and is intended to be checked against a budget with
+ * \c static_assert so that cost regressions are caught before they hit the compiler's limits.
+ *
+ * \c depth is the number of nested \c constexpr calls and corresponds directly to \c -fconstexpr-depth.
+ * \c steps is the number of \c constexpr function invocations; compilers count finer-grained operations
+ * for \c -fconstexpr-steps and \c -fconstexpr-ops-limit so it is proportional to, not equal to, those limits.
+ *
+ * The figures are derived by hand from the implementation.  The depths have been checked to be enough
+ * for GCC but are not tight; the steps have not been checked against any compiler.
+ */
+
+#ifndef CEXPR_COST_HPP
+#define CEXPR_COST_HPP
+
+#include <cstddef>
+#include "cexpr/detail/basic_list.hpp"
+
+namespace cexpr {
+
+//! Worst-case cost of evaluating an operation in a constant expression.
+struct cost {
+	std::size_t depth;
+	std::size_t steps;
+};
+
+//! Returns true if \p c fits within \p depth nested calls and \p steps invocations.
+constexpr bool within(cost c, std::size_t depth, std::size_t steps) {
+	return c.depth <= depth && c.steps <= steps;
+}
+
+//! Worst-case costs of the operations on \p Container.
+template<class Container>
+struct costs;
+
+template<typename T, std::size_t W, std::size_t H, class Layout>
+class grid;
+
+template<typename T, std::size_t N, class Compare>
+class priority_queue;
+
+namespace detail {
+
+constexpr std::size_t max(std::size_t a, std::size_t b) {
+	return a < b ? b : a;
+}
+
+constexpr std::size_t sum_to(std::size_t n) {
+	return n * (n + 1) / 2;
+}
+
+constexpr std::size_t sum_squares_to(std::size_t n) {
+	return n * (n + 1) * (2 * n + 1) / 6;
+}
+
+constexpr std::size_t log2_ceil(std::size_t n) {
+	return n <= 1 ? 0 : 1 + log2_ceil((n + 1) / 2);
+}
+
+// HINT: Each element costs a constructor call, two comparisons (operator!= calls operator==), an advance
+// (operator+ constructs an iterator) and a dereference, plus the walk of operator[] into the source.
+constexpr cost copy_cost(std::size_t n, std::size_t m) {
+	return { n + m + 2, n * (m + 8) + 3 };
+}
+
+// HINT: set and insert(T) walk two ranges of the list itself, hence twice the depth of a copy.
+constexpr cost set_cost(std::size_t n) {
+	return { 2 * n + 2, n * (n + 16) + 17 };
+}
+
+// HINT: A basic_range_chain of k ranges over lists of up to m elements walks up to k ranges to find
+// the front and to pop it.
+constexpr cost chain_cost(std::size_t n, std::size_t m, std::size_t k) {
+	return { n + m + k + 3, n * (6 * k + 5 + m) + 12 * k + 3 };
+}
+
+// HINT: Each of the up to l levels compares two heads, copies the tail of one list, recurses, copies the
+// result into the wider list and inserts the smaller head: 3l^2 + 31l + 35 invocations at width l.
+constexpr cost merge_cost(std::size_t l) {
+	return { 2 * l + 3, 3 * sum_squares_to(l) + 31 * sum_to(l) + 35 * l + 1 };
+}
+
+constexpr std::size_t sort_depth(std::size_t n) {
+	return n <= 1
+		? 1
+		: max(merge_cost(n).depth + 2, sort_depth((n + 1) / 2) + 2);
+}
+
+constexpr std::size_t sort_steps(std::size_t n) {
+	return n <= 1
+		? 1
+		: 21 + copy_cost(n / 2, n).steps + copy_cost((n + 1) / 2, n).steps
+		  + sort_steps(n / 2) + sort_steps((n + 1) / 2)
+		  + merge_cost(n).steps;
+}
+
+// HINT: Each of the up to log2(n) levels of a sift up looks up the parent twice and rebuilds the path to the
+// hole in the basic_tree.
+constexpr cost heap_sift_up_cost(std::size_t n) {
+	return { 2 * log2_ceil(n) + 4, log2_ceil(n) * (3 * log2_ceil(n) + 8) + log2_ceil(n) + 4 };
+}
+
+// HINT: Each of the up to log2(n) levels of a sift down looks up both children, the larger child again and
+// rebuilds the path to the hole in the basic_tree.
+constexpr cost heap_sift_down_cost(std::size_t n) {
+	return { 3 * log2_ceil(n) + 3, log2_ceil(n) * (7 * log2_ceil(n) + 12) + 5 * log2_ceil(n) + 11 };
+}
+
+// HINT: Copying the list into a basic_tree walks it once per element, then each of the at most n comparisons
+// per level of the sort looks up two elements of the tree.
+constexpr cost sort_indices_cost(std::size_t n) {
+	return {
+		max(sort_depth(n) + 2, n + log2_ceil(n) + 5),
+		copy_cost(n, 0).steps + sum_to(n) + 3 * n + sort_steps(n) + 2 * n * log2_ceil(n) * (log2_ceil(n) + 1) + 3
+	};
+}
+
+}
+
+template<typename T, std::size_t N>
+struct costs<detail::basic_list<T, N>> {
+	//! basic_list(), basic_list(T const&).
+	static constexpr cost construct() { return { N + 1, N + 1 }; }
+
+	//! basic_list(RandomAccessIterator, RandomAccessIterator) over a basic_list<T, M>.
+	template<std::size_t M>
+	static constexpr cost copy() { return detail::copy_cost(N, M); }
+
+	//! basic_list(basic_list<T, M> const&).
+	template<std::size_t M>
+	static constexpr cost convert() { return { N + M + 4, detail::copy_cost(N, M).steps + 7 }; }
+
+	//! operator[](size_type).
+	static constexpr cost index() { return { N, N }; }
+
+	//! set(size_type, T const&).
+	static constexpr cost set() { return detail::set_cost(N); }
+
+	//! insert(size_type, T const&).
+	static constexpr cost insert() { return detail::set_cost(N); }
+
+	//! insert(size_type, std::initializer_list<T>) and insert(size_type, RandomAccessIterator, RandomAccessIterator).
+	static constexpr cost insert_range() { return detail::chain_cost(N, N, 3); }
+
+	//! erase(size_type), erase(size_type, size_type) and their overloads taking a value.
+	static constexpr cost erase() { return detail::chain_cost(N, N, 2); }
+
+	//! concat of \p K lists of up to \p M elements each into this list.
+	template<std::size_t K, std::size_t M>
+	static constexpr cost concat() { return detail::chain_cost(N, M, K); }
+
+	//! detail::merge of a basic_list<T, N - M> and a basic_list<T, M>.
+	static constexpr cost merge() { return detail::merge_cost(N); }
+
+	//! sort(basic_list<T, N> const&, Compare).
+	static constexpr cost sort() { return { detail::sort_depth(N), detail::sort_steps(N) }; }
+
+	//! sort_indices(basic_list<T, N> const&, Compare).
+	static constexpr cost sort_indices() { return detail::sort_indices_cost(N); }
+
+	//! apply_permutation(basic_list<T, N> const&, basic_list<Index, N> const&).
+	static constexpr cost apply_permutation() { return { 2 * N + 3, N * (2 * N + 9) + 4 }; }
+};
+
+template<typename T, std::size_t W, std::size_t H, class Layout>
+struct costs<grid<T, W, H, Layout>> {
+	static constexpr std::size_t size = Layout::template layout<W, H>::size;
+
+	//! generate(Generator const&), grid(std::initializer_list<std::initializer_list<T>>).
+	static constexpr cost generate() { return { detail::log2_ceil(size) + 5, 8 * size + 2 }; }
+
+	//! at(size_type, size_type).
+	static constexpr cost at() { return { detail::log2_ceil(size) + 2, detail::log2_ceil(size) + 2 }; }
+
+	//! set(size_type, size_type, T const&).
+	static constexpr cost set() { return { detail::log2_ceil(size) + 3, 2 * detail::log2_ceil(size) + 4 }; }
+};
+
+template<typename T, std::size_t N, class Compare>
+struct costs<priority_queue<T, N, Compare>> {
+	//! priority_queue(detail::basic_list<T, N> const&, size_type, Compare const&).
+	static constexpr cost heapify() {
+		return {
+			detail::max(N + detail::log2_ceil(N) + 4, 4 * detail::log2_ceil(N) + 5),
+			detail::sum_to(N) + 4 * N + N / 2 * detail::heap_sift_down_cost(N).steps + 2
+		};
+	}
+
+	//! push(T const&).
+	static constexpr cost push() { return detail::heap_sift_up_cost(N); }
+
+	//! pop().
+	static constexpr cost pop() { return detail::heap_sift_down_cost(N); }
+
+	//! top().
+	static constexpr cost top() { return { detail::log2_ceil(N) + 2, detail::log2_ceil(N) + 2 }; }
+};
+
+}
+
+#endif
@@ -10,6 +10,8 @@
 #include <cstddef>
 #include <initializer_list>
 #include <iterator>
+#include <type_traits>
+#include <utility>
 
 namespace cexpr {
 namespace detail {
@@ -79,6 +81,112 @@ constexpr bool operator!=(basic_list_iterator<T, N> lhs, basic_list_iterator<T,
 	return !(lhs == rhs);
 }
 
+//! \c constexpr iterator over generator(position), generator(position + 1), ...
+//! \details Lets basic_list construct elements that are computed from their position in a single pass.
+template<class Generator>
+class basic_generator_iterator {
+public:
+	typedef decltype(std::declval<Generator const&>()(std::size_t())) value_type;
+
+	constexpr basic_generator_iterator(Generator const& generator, std::size_t position)
+		: generator(generator)
+		, position(position)
+		{}
+
+	//! Advances forwards \p pos elements.
+	constexpr basic_generator_iterator operator+(std::size_t pos) {
+		return { generator, position + pos };
+	}
+
+	constexpr value_type operator*() {
+		return generator(position);
+	}
+
+	friend constexpr bool operator==(basic_generator_iterator lhs, basic_generator_iterator rhs) {
+		return lhs.position == rhs.position;
+	}
+
+	friend constexpr bool operator!=(basic_generator_iterator lhs, basic_generator_iterator rhs) {
+		return !(lhs == rhs);
+	}
+
+private:
+	Generator generator;
+	std::size_t position;
+};
+
+//! Terminates a basic_range_chain.
+class basic_range_chain_end {
+public:
+	template<typename T>
+	constexpr T front(T const& value) {
+		return value;
+	}
+
+	constexpr basic_range_chain_end pop_front() {
+		return *this;
+	}
+};
+
+//! \c constexpr concatenation of the range ( \p first, \p last ] and the ranges in \p next.
+//! \details Consumed one element at a time by basic_list's constructor so that any number of ranges can be
+//! joined in a single pass.
+template<class RandomAccessIterator, class Next>
+class basic_range_chain {
+public:
+	constexpr basic_range_chain(RandomAccessIterator first, RandomAccessIterator last, Next const& next)
+		: first(first)
+		, last(last)
+		, next(next)
+		{}
+
+	//! Returns the first element, or \p value if every range is empty.
+	template<typename T>
+	constexpr T front(T const& value) {
+		return first != last
+			? *first
+			: next.front(value);
+	}
+
+	//! Returns the chain without its first element.
+	//! \warning Recurses once for each leading empty range.
+	constexpr basic_range_chain pop_front() {
+		return first != last
+			? basic_range_chain(first + 1, last, next)
+			: basic_range_chain(first, last, next.pop_front());
+	}
+
+private:
+	RandomAccessIterator first;
+	RandomAccessIterator last;
+	Next next;
+};
+
+//! The type of make_range_chain(first1, last1, first2, last2, ...).
+template<class... RandomAccessIterators>
+struct range_chain;
+
+template<>
+struct range_chain<> {
+	typedef basic_range_chain_end type;
+};
+
+template<class RandomAccessIterator, class... RandomAccessIterators>
+struct range_chain<RandomAccessIterator, RandomAccessIterator, RandomAccessIterators...> {
+	typedef basic_range_chain<RandomAccessIterator, typename range_chain<RandomAccessIterators...>::type> type;
+};
+
+constexpr basic_range_chain_end make_range_chain() {
+	return {};
+}
+
+//! Chains the ranges ( \p first, \p last ] ++ ( \p first2, \p last2 ] ++ ...
+template<class RandomAccessIterator, class... RandomAccessIterators>
+constexpr typename range_chain<RandomAccessIterator, RandomAccessIterator, RandomAccessIterators...>::type
+make_range_chain(RandomAccessIterator first, RandomAccessIterator last, RandomAccessIterators... ranges) {
+	return { first, last, make_range_chain(ranges...) };
+}
+
 //! \c constexpr list containing exactly \p N elements of type \p T.
 //! \todo Throw exceptions when indexing out of range (index N safe for non-accessor methods).
 //! \todo Take parameters as \c const_iterator rather than \c size_type where appropriate once \c basic_list_iterator does not copy list.
@@ -166,6 +274,21 @@ public:
 		, tail(first != last ? first + 1 : first, last, value)
 		{}
 
+	//! Constructs a list containing up to the first \p N elements of the concatenation of \p ranges.
+	//! \details The remaining elements are default-constructed.
+	template<class RandomAccessIterator, class Next>
+	constexpr explicit basic_list(basic_range_chain<RandomAccessIterator, Next> const& ranges)
+		: basic_list(ranges, T())
+		{}
+
+	//! Constructs a list containing up to the first \p N elements of the concatenation of \p ranges.
+	//! \details The remaining elements are copy-constructed from \p value.
+	template<class RandomAccessIterator, class Next>
+	constexpr basic_list(basic_range_chain<RandomAccessIterator, Next> const& ranges, T const& value)
+		: head(ranges.front(value))
+		, tail(ranges.pop_front(), value)
+		{}
+
 	//! Returns the element at \p pos.
 	constexpr T operator[](size_type pos) {
 		return pos == 0
@@ -186,10 +309,22 @@ public:
 
 	//! Inserts a series of elements at \p pos.
 	constexpr basic_list insert(size_type pos, std::initializer_list<T> values) {
+		return insert(pos, values.begin(), values.end());
+	}
+
+	//! Inserts the elements of \p values at \p pos.
+	template<std::size_t M>
+	constexpr basic_list insert(size_type pos, basic_list<T, M> const& values) {
+		return insert(pos, values.cbegin(), values.cend());
+	}
+
+	//! Inserts the elements in the range ( \p first, \p last ] at \p pos.
+	template<class RandomAccessIterator>
+	constexpr basic_list insert(size_type pos, RandomAccessIterator first, RandomAccessIterator last) {
 		// HINT: head will never be used.
-		// TODO: Optimize the case values = {} to "return *this".
+		// TODO: Optimize the case first == last to "return *this".
 		// TODO: Optimize the case pos > N to "return *this".
-		return { cbegin(), cbegin() + pos, values.begin(), values.end(), cbegin() + pos, cend(), head };
+		return basic_list(make_range_chain(cbegin(), cbegin() + pos, first, last, cbegin() + pos, cend()), head);
 	}
 
 	//! Removes the element at \p pos.
@@ -217,7 +352,7 @@ public:
 		// TODO: Optimize the case first == last + 1 to "return *this".
 		// TODO: Optimize the case first > N to "return *this".
 		// TODO: Throw when first > last + 1.
-		return { cbegin(), cbegin() + first, cbegin() + last, cend(), value };
+		return basic_list(make_range_chain(cbegin(), cbegin() + first, cbegin() + last, cend()), value);
 	}
 
 	//! Returns the number of elements.
@@ -245,21 +380,15 @@ public:
 		return const_iterator(*this, N);
 	}
 
-private:
-	//! Constructs a list containing up to the first \p N elements in the range ( \p first1, \p last1 ] ++ ( \p first2, \p last2 ].
-	//! \details The remaining elements are copy-constructed from \p value.
-	template<class RandomAccessIterator1, class RandomAccessIterator2>
-	constexpr basic_list(
-		RandomAccessIterator1 first1, RandomAccessIterator1 last1,
-		RandomAccessIterator2 first2, RandomAccessIterator2 last2,
-		T const& value)
-		: head(first1 != last1 ? *first1 : first2 != last2 ? *first2 : value)
-		, tail(
-			first1 != last1 ? first1 + 1 : first1, last1,
-			first1 == last1 && first2 != last2 ? first2 + 1 : first2, last2,
-			value)
-		{}
+	//! Returns a pointer to the first element for use at runtime.
+	//! \details Only available for arithmetic \p T, for which head and the heads of the tails are laid out
+	//! contiguously.
+	T const* data() const {
+		static_assert(std::is_arithmetic<T>::value, "data() requires contiguous arithmetic elements");
+		return &head;
+	}
 
+private:
 	//! Constructs a list containing up to the first \p N elements in the range ( \p first1, \p last1 ] ++ \p insert ++ ( \p first2, \p last2 ].
 	//! \details \p inserted should be false when called non-recursively.
 	//! \details The remaining elements are copy-constructed from \p value.
@@ -278,22 +407,6 @@ private:
 			value)
 		{}
 
-	//! Constructs a list containing up to the first \p N elements in the range ( \p first1, \p last1 ] ++ ( \p first2, \p last2 ] ++ ( \p first3, \p last3 ].
-	//! \details The remaining elements are copy-constructed from \p value.
-	template<class RandomAccessIterator1, class RandomAccessIterator2, class RandomAccessIterator3>
-	constexpr basic_list(
-		RandomAccessIterator1 first1, RandomAccessIterator1 last1,
-		RandomAccessIterator2 first2, RandomAccessIterator2 last2,
-		RandomAccessIterator3 first3, RandomAccessIterator3 last3,
-		T const& value)
-		: head(first1 != last1 ? *first1 : first2 != last2 ? *first2 : first3 != last3 ? *first3 : value)
-		, tail(
-			first1 != last1 ? first1 + 1 : first1, last1,
-			first1 == last1 && first2 != last2 ? first2 + 1 : first2, last2,
-			first1 == last1 && first2 == last2 && first3 != last3 ? first3 + 1 : first3, last3,
-			value)
-		{}
-
 	//! Constructs a list containing the first \p N elements in \p values.
 	//! \details The remaining elements are copy-constructed from \p value.
 	//! \deprecated Will be removed once GCC stops ICEing on std::begin.
@@ -340,6 +453,12 @@ public:
 	template<class RandomAccessIterator>
 	constexpr basic_list(RandomAccessIterator first, RandomAccessIterator last, T const& value) {}
 
+	template<class RandomAccessIterator, class Next>
+	constexpr explicit basic_list(basic_range_chain<RandomAccessIterator, Next> const& ranges) {}
+
+	template<class RandomAccessIterator, class Next>
+	constexpr basic_list(basic_range_chain<RandomAccessIterator, Next> const& ranges, T const& value) {}
+
 	constexpr T operator[](size_type pos) { return fail(), T(); }
 
 	constexpr basic_list set(size_type pos, T const& value) { return *this; }
@@ -347,6 +466,12 @@ public:
 	constexpr basic_list insert(size_type pos, T const& value) { return *this; }
 	constexpr basic_list insert(size_type pos, std::initializer_list<T> values) { return *this; }
 
+	template<std::size_t M>
+	constexpr basic_list insert(size_type pos, basic_list<T, M> const& values) { return *this; }
+
+	template<class RandomAccessIterator>
+	constexpr basic_list insert(size_type pos, RandomAccessIterator first, RandomAccessIterator last) { return *this; }
+
 	constexpr basic_list erase(size_type pos) { return *this; }
 	constexpr basic_list erase(size_type pos, T const& value) { return *this; }
 	constexpr basic_list erase(size_type first, size_type last) { return *this; }
@@ -360,19 +485,18 @@ public:
 	constexpr const_iterator end() { return cend(); }
 	constexpr const_iterator cend() { return const_iterator(*this); }
 
+	T const* data() const {
+		static_assert(std::is_arithmetic<T>::value, "data() requires contiguous arithmetic elements");
+		return nullptr;
+	}
+
 private:
 	// TODO: More descript error messages.
 	constexpr int fail() { return throw "attempt to access outside of array", 0; }
 
-	template<class RandomAccessIterator1, class RandomAccessIterator2>
-	constexpr basic_list(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2, RandomAccessIterator2 last2, T const& value) {}
-	
 	template<class RandomAccessIterator1, class RandomAccessIterator2>
 	constexpr basic_list(RandomAccessIterator1 first1, RandomAccessIterator1 last1, T const& insert, bool inserted, RandomAccessIterator2 first2, RandomAccessIterator2 last2, T const& value) {}
 
-	template<class RandomAccessIterator1, class RandomAccessIterator2, class RandomAccessIterator3>
-	constexpr basic_list(RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2, RandomAccessIterator2 last2, RandomAccessIterator3 first3, RandomAccessIterator3 last3, T const& value) {}
-
 	template<std::size_t M>
 	constexpr basic_list(T const (&values)[M], size_type pos, T const& value) {}
 };
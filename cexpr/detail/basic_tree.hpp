@@ -0,0 +1,167 @@
+/*!
+ * \file basic_tree.hpp
+ * \brief \c constexpr statically-sized container with logarithmic recursion depth.
+ * \details Splits the elements into two halves rather than a head and a tail so that indexing,
+ * construction and set recurse O(log N) times instead of O(N).  The leaves are stored left to right so the
+ * elements are contiguous at runtime, as with basic_list.
+ */
+
+#ifndef CEXPR_DETAIL_TREE
+#define CEXPR_DETAIL_TREE
+
+#include <cstddef>
+#include <type_traits>
+#include "cexpr/detail/basic_list.hpp"
+
+namespace cexpr {
+namespace detail {
+
+//! \c constexpr balanced tree containing exactly \p N elements of type \p T.
+template<typename T, std::size_t N>
+class basic_tree {
+public:
+	typedef T value_type;
+	typedef std::size_t size_type;
+
+	//! Constructs a tree containing \p N default-constructed elements.
+	constexpr basic_tree()
+		: left()
+		, right()
+		{}
+
+	//! Constructs a tree containing \p N elements copy-constructed from \p value.
+	constexpr explicit basic_tree(T const& value)
+		: left(value)
+		, right(value)
+		{}
+
+	//! Constructs a tree containing generator(offset), ..., generator(offset + N - 1).
+	template<class Generator>
+	constexpr basic_tree(Generator const& generator, size_type offset)
+		: left(generator, offset)
+		, right(generator, offset + N / 2)
+		{}
+
+	//! Returns the element at \p pos.
+	//! \warning Recurses log2( \p N ) times.
+	constexpr T operator[](size_type pos) {
+		return pos < N / 2
+			? left[pos]
+			: right[pos - N / 2];
+	}
+
+	//! Overwrites the element at \p pos.
+	//! \details Only the nodes on the path to \p pos are rebuilt.
+	constexpr basic_tree set(size_type pos, T const& value) {
+		return pos < N / 2
+			? basic_tree(left.set(pos, value), right)
+			: basic_tree(left, right.set(pos - N / 2, value));
+	}
+
+	//! Returns the number of elements.
+	constexpr size_type size() {
+		return N;
+	}
+
+	//! Returns a pointer to the first element for use at runtime.
+	//! \details Only available for arithmetic \p T, for which the leaves are laid out contiguously.
+	T const* data() const {
+		static_assert(std::is_arithmetic<T>::value, "data() requires contiguous arithmetic elements");
+		return left.data();
+	}
+
+private:
+	constexpr basic_tree(basic_tree<T, N / 2> const& left, basic_tree<T, N - N / 2> const& right)
+		: left(left)
+		, right(right)
+		{}
+
+	basic_tree<T, N / 2> left;
+	basic_tree<T, N - N / 2> right;
+};
+
+template<typename T>
+class basic_tree<T, 1> {
+public:
+	typedef T value_type;
+	typedef std::size_t size_type;
+
+	constexpr basic_tree() : value() {}
+	constexpr explicit basic_tree(T const& value) : value(value) {}
+
+	template<class Generator>
+	constexpr basic_tree(Generator const& generator, size_type offset) : value(generator(offset)) {}
+
+	constexpr T operator[](size_type pos) { return pos == 0 ? value : (fail(), T()); }
+
+	constexpr basic_tree set(size_type pos, T const& value) { return pos == 0 ? basic_tree(value) : (fail(), *this); }
+
+	constexpr size_type size() { return 1; }
+
+	T const* data() const {
+		static_assert(std::is_arithmetic<T>::value, "data() requires contiguous arithmetic elements");
+		return &value;
+	}
+
+private:
+	// TODO: More descript error messages.
+	constexpr int fail() { return throw "attempt to access outside of tree", 0; }
+
+	T value;
+};
+
+template<typename T>
+class basic_tree<T, 0> {
+public:
+	typedef T value_type;
+	typedef std::size_t size_type;
+
+	constexpr basic_tree() {}
+	constexpr explicit basic_tree(T const& value) {}
+
+	template<class Generator>
+	constexpr basic_tree(Generator const& generator, size_type offset) {}
+
+	constexpr T operator[](size_type pos) { return fail(), T(); }
+
+	constexpr basic_tree set(size_type pos, T const& value) { return fail(), *this; }
+
+	constexpr size_type size() { return 0; }
+
+	T const* data() const {
+		static_assert(std::is_arithmetic<T>::value, "data() requires contiguous arithmetic elements");
+		return nullptr;
+	}
+
+private:
+	// TODO: More descript error messages.
+	constexpr int fail() { return throw "attempt to access outside of tree", 0; }
+};
+
+//! Generates the elements of \p list.
+template<typename T, std::size_t N>
+class list_elements {
+public:
+	constexpr explicit list_elements(basic_list<T, N> const& list)
+		: list(&list)
+		{}
+
+	constexpr T operator()(std::size_t pos) {
+		return (*list)[pos];
+	}
+
+private:
+	basic_list<T, N> const* list;
+};
+
+//! Returns a basic_tree with the elements of \p list.
+//! \warning Each element walks the list, O(N^2) invocations.
+template<typename T, std::size_t N>
+constexpr basic_tree<T, N> list_tree(basic_list<T, N> const& list) {
+	return basic_tree<T, N>(list_elements<T, N>(list), 0);
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,325 @@
+/*!
+ * \file grid.hpp
+ * \brief \c constexpr two-dimensional container of \p W x \p H elements.
+ * \details Backed by a single detail::basic_tree so that at and set recurse O(log(W * H)) times rather than
+ * O(W + H) as with a basic_list of basic_lists.  \p Layout chooses how the cells are ordered in storage,
+ * which matters for runtime access through data().
+ */
+
+#ifndef CEXPR_GRID_HPP
+#define CEXPR_GRID_HPP
+
+#include <cstddef>
+#include <initializer_list>
+#include "cexpr/detail/basic_tree.hpp"
+
+namespace cexpr {
+
+//! Stores row \p r in positions [ \p r * \p W, \p r * \p W + \p W ).
+struct row_major {
+	template<std::size_t W, std::size_t H>
+	struct layout {
+		static constexpr std::size_t size = W * H;
+
+		static constexpr std::size_t position(std::size_t row, std::size_t column) {
+			return row * W + column;
+		}
+
+		static constexpr std::size_t row(std::size_t pos) {
+			return pos / W;
+		}
+
+		static constexpr std::size_t column(std::size_t pos) {
+			return pos % W;
+		}
+	};
+};
+
+//! Stores \p TW x \p TH tiles one after another in row-major order, each tile itself row-major.
+//! \details Neighbouring rows of a tile share cache lines, which keeps column-wise and blocked runtime access
+//! local.  The grid is padded to a whole number of tiles with default-constructed elements.
+template<std::size_t TW, std::size_t TH>
+struct tiled {
+	static_assert(TW > 0 && TH > 0, "tiles must not be empty");
+
+	template<std::size_t W, std::size_t H>
+	struct layout {
+		static constexpr std::size_t tiles_across = (W + TW - 1) / TW;
+		static constexpr std::size_t tiles_down = (H + TH - 1) / TH;
+		static constexpr std::size_t size = tiles_across * tiles_down * TW * TH;
+
+		static constexpr std::size_t position(std::size_t row, std::size_t column) {
+			return ((row / TH) * tiles_across + column / TW) * (TW * TH) + (row % TH) * TW + column % TW;
+		}
+
+		static constexpr std::size_t row(std::size_t pos) {
+			return pos / (TW * TH) / tiles_across * TH + pos % (TW * TH) / TW;
+		}
+
+		static constexpr std::size_t column(std::size_t pos) {
+			return pos / (TW * TH) % tiles_across * TW + pos % TW;
+		}
+	};
+};
+
+template<class Grid>
+class grid_row;
+
+template<class Grid>
+class grid_column;
+
+template<class Grid>
+class grid_transpose;
+
+namespace detail {
+
+//! Generates the cells of a grid in storage order from \p generator(row, column).
+template<typename T, std::size_t W, std::size_t H, class Layout, class Generator>
+class grid_cells {
+public:
+	constexpr explicit grid_cells(Generator const& generator)
+		: generator(generator)
+		{}
+
+	constexpr T operator()(std::size_t pos) {
+		return Layout::row(pos) < H && Layout::column(pos) < W
+			? generator(Layout::row(pos), Layout::column(pos))
+			: T();
+	}
+
+private:
+	Generator generator;
+};
+
+//! Returns true if none of \p rows from \p row onwards is longer than \p W.
+template<typename T>
+constexpr bool rows_fit(std::initializer_list<std::initializer_list<T>> rows, std::size_t W, std::size_t row) {
+	return row == rows.size()
+		? true
+		: rows.begin()[row].size() <= W && rows_fit(rows, W, row + 1);
+}
+
+//! Generates the cells of a grid from nested initializer lists.
+template<typename T>
+class grid_rows {
+public:
+	constexpr explicit grid_rows(std::initializer_list<std::initializer_list<T>> rows)
+		: rows(rows)
+		{}
+
+	constexpr T operator()(std::size_t row, std::size_t column) {
+		return row < rows.size() && column < rows.begin()[row].size()
+			? rows.begin()[row].begin()[column]
+			: T();
+	}
+
+private:
+	std::initializer_list<std::initializer_list<T>> rows;
+};
+
+}
+
+//! \c constexpr grid of \p H rows of \p W elements of type \p T.
+template<typename T, std::size_t W, std::size_t H, class Layout = row_major>
+class grid {
+public:
+	typedef T value_type;
+	typedef std::size_t size_type;
+	typedef typename Layout::template layout<W, H> layout_type;
+	typedef grid_row<grid> row_type;
+	typedef grid_column<grid> column_type;
+	typedef grid_transpose<grid> transpose_type;
+
+	//! Constructs a grid of default-constructed elements.
+	constexpr grid()
+		: cells()
+		{}
+
+	//! Constructs a grid of elements copy-constructed from \p value.
+	constexpr explicit grid(T const& value)
+		: cells(value)
+		{}
+
+	//! Constructs a grid from up to \p H rows of up to \p W elements.
+	//! \details Missing elements are default-constructed; more rows or elements fail as with at.
+	constexpr grid(std::initializer_list<std::initializer_list<T>> rows)
+		: grid(rows.size() <= H && detail::rows_fit(rows, W, 0)
+			? detail::grid_rows<T>(rows)
+			: (fail(), detail::grid_rows<T>(rows)), 0)
+		{}
+
+	//! Returns a grid whose element at ( \p row, \p column ) is \p generator(row, column).
+	template<class Generator>
+	static constexpr grid generate(Generator const& generator) {
+		return grid(generator, 0);
+	}
+
+	//! Returns the element at ( \p row, \p column ).
+	//! \warning Recurses log2( \p W * \p H ) times.
+	constexpr T at(size_type row, size_type column) {
+		return row < H && column < W
+			? cells[layout_type::position(row, column)]
+			: (fail(), T());
+	}
+
+	//! Overwrites the element at ( \p row, \p column ).
+	//! \details Only the O(log( \p W * \p H )) nodes on the path to the element are rebuilt.
+	constexpr grid set(size_type row, size_type column, T const& value) {
+		return row < H && column < W
+			? grid(cells.set(layout_type::position(row, column), value))
+			: (fail(), *this);
+	}
+
+	//! Returns a view of row \p row.
+	constexpr row_type row(size_type row) {
+		return row_type(*this, row);
+	}
+
+	//! Returns a view of column \p column.
+	constexpr column_type column(size_type column) {
+		return column_type(*this, column);
+	}
+
+	//! Returns a view with the rows and columns swapped.
+	constexpr transpose_type transpose() {
+		return transpose_type(*this);
+	}
+
+	//! Returns the number of columns.
+	constexpr size_type width() {
+		return W;
+	}
+
+	//! Returns the number of rows.
+	constexpr size_type height() {
+		return H;
+	}
+
+	//! Returns the position of ( \p row, \p column ) in data().
+	static constexpr size_type position(size_type row, size_type column) {
+		return layout_type::position(row, column);
+	}
+
+	//! Returns a pointer to the cells in \p Layout order for use at runtime.
+	//! \details The element at ( \p row, \p column ) is data()[position(row, column)].
+	//! \details Only available for arithmetic \p T.
+	T const* data() const {
+		return cells.data();
+	}
+
+private:
+	template<class Generator>
+	constexpr grid(Generator const& generator, size_type offset)
+		: cells(detail::grid_cells<T, W, H, layout_type, Generator>(generator), offset)
+		{}
+
+	constexpr explicit grid(detail::basic_tree<T, layout_type::size> const& cells)
+		: cells(cells)
+		{}
+
+	// TODO: More descript error messages.
+	constexpr int fail() { return throw "attempt to access outside of grid", 0; }
+
+	detail::basic_tree<T, layout_type::size> cells;
+};
+
+//! View of one row of \p Grid.
+//! \warning Makes a copy of the grid.
+template<class Grid>
+class grid_row {
+public:
+	typedef typename Grid::value_type value_type;
+	typedef typename Grid::size_type size_type;
+
+	constexpr grid_row(Grid const& grid, size_type row)
+		: grid(grid)
+		, row(row)
+		{}
+
+	//! Returns the element in column \p column.
+	constexpr value_type operator[](size_type column) {
+		return grid.at(row, column);
+	}
+
+	//! Returns the number of elements.
+	constexpr size_type size() {
+		return grid.width();
+	}
+
+private:
+	Grid grid;
+	size_type row;
+};
+
+//! View of one column of \p Grid.
+//! \warning Makes a copy of the grid.
+template<class Grid>
+class grid_column {
+public:
+	typedef typename Grid::value_type value_type;
+	typedef typename Grid::size_type size_type;
+
+	constexpr grid_column(Grid const& grid, size_type column)
+		: grid(grid)
+		, column(column)
+		{}
+
+	//! Returns the element in row \p row.
+	constexpr value_type operator[](size_type row) {
+		return grid.at(row, column);
+	}
+
+	//! Returns the number of elements.
+	constexpr size_type size() {
+		return grid.height();
+	}
+
+private:
+	Grid grid;
+	size_type column;
+};
+
+//! View of \p Grid with its rows and columns swapped.
+//! \warning Makes a copy of the grid.
+template<class Grid>
+class grid_transpose {
+public:
+	typedef typename Grid::value_type value_type;
+	typedef typename Grid::size_type size_type;
+
+	constexpr explicit grid_transpose(Grid const& grid)
+		: grid(grid)
+		{}
+
+	//! Returns the element at ( \p column, \p row ) of the grid.
+	constexpr value_type at(size_type row, size_type column) {
+		return grid.at(column, row);
+	}
+
+	//! Returns the number of columns, the height of the grid.
+	constexpr size_type width() {
+		return grid.height();
+	}
+
+	//! Returns the number of rows, the width of the grid.
+	constexpr size_type height() {
+		return grid.width();
+	}
+
+	//! Returns a view of row \p row, column \p row of the grid.
+	constexpr grid_column<Grid> row(size_type row) {
+		return grid_column<Grid>(grid, row);
+	}
+
+	//! Returns a view of column \p column, row \p column of the grid.
+	constexpr grid_row<Grid> column(size_type column) {
+		return grid_row<Grid>(grid, column);
+	}
+
+private:
+	Grid grid;
+};
+
+}
+
+#endif
@@ -0,0 +1,188 @@
+/*!
+ * \file priority_queue.hpp
+ * \brief \c constexpr binary heap of up to \p N elements.
+ * \details The heap is stored in a detail::basic_tree so that each of the O(log N) moves of a sift reads and
+ * rebuilds only one root-to-leaf path, O(log N) invocations, making push and pop O(log^2 N).
+ */
+
+#ifndef CEXPR_PRIORITY_QUEUE_HPP
+#define CEXPR_PRIORITY_QUEUE_HPP
+
+#include <cstddef>
+#include <functional> // TODO: Is std::less constexpr?
+#include "cexpr/detail/basic_list.hpp"
+#include "cexpr/detail/basic_tree.hpp"
+
+namespace cexpr {
+
+namespace detail {
+
+constexpr std::size_t heap_parent(std::size_t pos) {
+	return (pos - 1) / 2;
+}
+
+template<typename T, std::size_t N, class Compare>
+constexpr std::size_t heap_larger_child(basic_tree<T, N> const& heap, std::size_t size, std::size_t child, Compare cmp) {
+	return child + 1 < size && cmp(heap[child], heap[child + 1])
+		? child + 1
+		: child;
+}
+
+/*
+ * while (hole > 0 && heap[parent(hole)] < value)
+ *     heap[hole] = heap[parent(hole)], hole = parent(hole)
+ * heap[hole] = value
+ */
+template<typename T, std::size_t N, class Compare>
+constexpr basic_tree<T, N> heap_sift_up(basic_tree<T, N> const& heap, std::size_t hole, T const& value, Compare cmp) {
+	return hole > 0 && cmp(heap[heap_parent(hole)], value)
+		? heap_sift_up(heap.set(hole, heap[heap_parent(hole)]), heap_parent(hole), value, cmp)
+		: heap.set(hole, value);
+}
+
+template<typename T, std::size_t N, class Compare>
+constexpr basic_tree<T, N> heap_sift_down(basic_tree<T, N> const& heap, std::size_t size, std::size_t hole, T const& value, Compare cmp);
+
+template<typename T, std::size_t N, class Compare>
+constexpr basic_tree<T, N> heap_sift_down_to(basic_tree<T, N> const& heap, std::size_t size, std::size_t hole, std::size_t child, T const& value, Compare cmp) {
+	return child < size && cmp(value, heap[child])
+		? heap_sift_down(heap.set(hole, heap[child]), size, child, value, cmp)
+		: heap.set(hole, value);
+}
+
+/*
+ * while (child(hole) < size && value < heap[larger child(hole)])
+ *     heap[hole] = heap[larger child(hole)], hole = larger child(hole)
+ * heap[hole] = value
+ */
+template<typename T, std::size_t N, class Compare>
+constexpr basic_tree<T, N> heap_sift_down(basic_tree<T, N> const& heap, std::size_t size, std::size_t hole, T const& value, Compare cmp) {
+	return heap_sift_down_to(heap, size, hole,
+	                         2 * hole + 1 < size ? heap_larger_child(heap, size, 2 * hole + 1, cmp) : size,
+	                         value, cmp);
+}
+
+/*
+ * for (pos = last; pos > first; --pos)
+ *     sift_down(heap, pos - 1)
+ */
+template<typename T, std::size_t N, class Compare>
+constexpr basic_tree<T, N> heapify(basic_tree<T, N> const& heap, std::size_t size, std::size_t first, std::size_t last, Compare cmp) {
+	return last - first <= 1
+		? first < last ? heap_sift_down(heap, size, first, heap[first], cmp) : heap
+		: heapify(heapify(heap, size, (first + last) / 2, last, cmp), size, first, (first + last) / 2, cmp);
+}
+
+//! Generates the elements of \p heap.
+template<typename T, std::size_t N>
+class tree_elements {
+public:
+	constexpr explicit tree_elements(basic_tree<T, N> const& tree)
+		: tree(&tree)
+		{}
+
+	constexpr T operator()(std::size_t pos) {
+		return (*tree)[pos];
+	}
+
+private:
+	basic_tree<T, N> const* tree;
+};
+
+}
+
+//! \c constexpr priority queue holding up to \p N elements of type \p T.
+//! \details The element for which \p Compare returns false against every other element is on top, so
+//! \c std::less gives a max-heap as with \c std::priority_queue.
+template<typename T, std::size_t N, class Compare = std::less<T>>
+class priority_queue {
+public:
+	typedef T value_type;
+	typedef std::size_t size_type;
+	typedef Compare value_compare;
+
+	//! Constructs an empty queue.
+	constexpr explicit priority_queue(Compare const& cmp = Compare())
+		: heap()
+		, count(0)
+		, cmp(cmp)
+		{}
+
+	//! Constructs a queue of the first \p size elements of \p list.
+	//! \details Heapifies bottom-up with O(N) sifts of O(log^2 N) invocations each.
+	//! \warning Copying \p list walks it once per element, O(N^2) invocations.
+	constexpr priority_queue(detail::basic_list<T, N> const& list, size_type size = N, Compare const& cmp = Compare())
+		: heap(detail::heapify(detail::list_tree(list), size, 0, size / 2, cmp))
+		, count(size)
+		, cmp(cmp)
+		{}
+
+	//! Returns the element with the highest priority.
+	constexpr T top() {
+		return count > 0
+			? heap[0]
+			: (fail(), T());
+	}
+
+	//! Returns a queue that also holds \p value.
+	//! \details O(log N) comparisons and O(log^2 N) invocations.
+	constexpr priority_queue push(T const& value) {
+		return count < N
+			? priority_queue(detail::heap_sift_up(heap, count, value, cmp), count + 1, cmp, false)
+			: (fail(), *this);
+	}
+
+	//! Returns a queue without the element with the highest priority.
+	//! \details O(log N) comparisons and O(log^2 N) invocations.
+	constexpr priority_queue pop() {
+		return count > 0
+			? priority_queue(detail::heap_sift_down(heap, count - 1, 0, heap[count - 1], cmp), count - 1, cmp, false)
+			: (fail(), *this);
+	}
+
+	//! Returns true if there are no elements.
+	constexpr bool empty() {
+		return count == 0;
+	}
+
+	//! Returns the number of elements.
+	constexpr size_type size() {
+		return count;
+	}
+
+	//! Returns the maximum number of elements.
+	constexpr size_type max_size() {
+		return N;
+	}
+
+	//! Returns the heap; only the first size() elements are meaningful.
+	constexpr detail::basic_list<T, N> list() {
+		return detail::basic_list<T, N>(detail::basic_generator_iterator<detail::tree_elements<T, N>>(detail::tree_elements<T, N>(heap), 0),
+		                                detail::basic_generator_iterator<detail::tree_elements<T, N>>(detail::tree_elements<T, N>(heap), N));
+	}
+
+	//! Returns the heap as a flat array of size() elements for use at runtime.
+	//! \details heap[0] is top() and the children of heap[i] are heap[2i + 1] and heap[2i + 2].
+	//! \details Only available for arithmetic \p T.
+	T const* data() const {
+		return heap.data();
+	}
+
+private:
+	//! Constructs a queue from an existing heap.
+	constexpr priority_queue(detail::basic_tree<T, N> const& heap, size_type count, Compare const& cmp, bool)
+		: heap(heap)
+		, count(count)
+		, cmp(cmp)
+		{}
+
+	constexpr int fail() { return throw "priority_queue is full or empty", 0; }
+
+	detail::basic_tree<T, N> heap;
+	size_type count;
+	Compare cmp;
+};
+
+}
+
+#endif
@@ -0,0 +1,411 @@
+/*!
+ * \file algorithm.hpp
+ * \brief Runtime counterparts of cexpr/algorithm.hpp for materialised basic_lists.
+ * \details The \c constexpr algorithms can be called at runtime but walk operator[] one element at a time.
+ * These scan the contiguous storage instead, using SSE2 or AVX2 kernels (chosen once, at runtime) for \c int
+ * and \c float elements and scalar loops for every other arithmetic type.
+ *
+ * The results are identical to the \c constexpr versions: reductions interleave the elements across
+ * cexpr::detail::reduce_lanes accumulators in the same order, so even floating-point sums agree bit for bit
+ * (provided the compiler is not allowed to reassociate, e.g. by \c -ffast-math).
+ *
+ * Define \c CEXPR_NO_SIMD to always use the scalar loops.
+ */
+
+#ifndef CEXPR_RUNTIME_ALGORITHM_HPP
+#define CEXPR_RUNTIME_ALGORITHM_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "cexpr/algorithm.hpp"
+#include "cexpr/detail/basic_list.hpp"
+
+#if !defined(CEXPR_NO_SIMD) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CEXPR_RUNTIME_X86_64
+#include <immintrin.h>
+#endif
+
+namespace cexpr {
+namespace runtime {
+
+//! Returns the position of the first element in \p list equal to \p value, or \p N if there is none.
+template<typename T, std::size_t N>
+std::size_t find(cexpr::detail::basic_list<T, N> const& list, T const& value);
+
+//! Returns the number of elements in \p list equal to \p value.
+template<typename T, std::size_t N>
+std::size_t count(cexpr::detail::basic_list<T, N> const& list, T const& value);
+
+//! Returns the smallest element in \p list.
+template<typename T, std::size_t N>
+T min(cexpr::detail::basic_list<T, N> const& list);
+
+//! Returns the largest element in \p list.
+template<typename T, std::size_t N>
+T max(cexpr::detail::basic_list<T, N> const& list);
+
+//! Returns the sum of the elements in \p list.
+//! \warning Integer sums that overflow wrap here but do not compile as constant expressions.
+template<typename T, std::size_t N>
+T sum(cexpr::detail::basic_list<T, N> const& list);
+
+namespace detail {
+
+using cexpr::detail::reduce_lanes;
+using cexpr::detail::minimum;
+using cexpr::detail::maximum;
+using cexpr::detail::plus;
+
+//! Instruction sets that the kernels are specialised for.
+enum class isa { scalar, sse2, avx2 };
+
+inline isa detect_isa() {
+#ifdef CEXPR_RUNTIME_X86_64
+	__builtin_cpu_init();
+	return __builtin_cpu_supports("avx2") ? isa::avx2 : isa::sse2;
+#else
+	return isa::scalar;
+#endif
+}
+
+//! Returns the best instruction set supported by this processor.
+inline isa supported_isa() {
+	static isa const value = detect_isa();
+	return value;
+}
+
+// Scalar kernels, also used for the remainders of the vector kernels.
+
+template<typename T>
+std::size_t find(T const* data, std::size_t n, T const& value, std::size_t pos) {
+	while (pos < n && !(data[pos] == value))
+		++pos;
+	return pos;
+}
+
+template<typename T>
+std::size_t count(T const* data, std::size_t n, T const& value, std::size_t pos) {
+	std::size_t result = 0;
+	for (; pos < n; ++pos)
+		result += data[pos] == value ? 1 : 0;
+	return result;
+}
+
+//! Folds the elements from \p pos onwards into \p lanes in the order of cexpr::detail::reduce.
+template<typename T, class Operation>
+void reduce_into(T (&lanes)[reduce_lanes], T const* data, std::size_t n, std::size_t pos, Operation op) {
+	for (; pos < n; ++pos)
+		lanes[pos % reduce_lanes] = op(lanes[pos % reduce_lanes], data[pos]);
+}
+
+template<typename T, class Operation>
+T combine(T const (&lanes)[reduce_lanes], std::size_t n, Operation op) {
+	T result = lanes[0];
+	for (std::size_t lane = 1; lane < reduce_lanes && lane < n; ++lane)
+		result = op(result, lanes[lane]);
+	return result;
+}
+
+template<typename T, class Operation>
+T reduce(T const* data, std::size_t n, Operation op) {
+	T lanes[reduce_lanes];
+	std::size_t pos = 0;
+	for (; pos < reduce_lanes && pos < n; ++pos)
+		lanes[pos] = data[pos];
+	reduce_into(lanes, data, n, pos, op);
+	return combine(lanes, n, op);
+}
+
+#ifdef CEXPR_RUNTIME_X86_64
+
+#define CEXPR_TARGET_SSE2 __attribute__((target("sse2")))
+#define CEXPR_TARGET_AVX2 __attribute__((target("avx2")))
+
+namespace sse2 {
+
+struct float_ops {
+	typedef float value_type;
+	typedef __m128 vector;
+	static const std::size_t width = 4;
+
+	CEXPR_TARGET_SSE2 static vector load(float const* data) { return _mm_loadu_ps(data); }
+	CEXPR_TARGET_SSE2 static vector splat(float value) { return _mm_set1_ps(value); }
+	CEXPR_TARGET_SSE2 static void store(float* data, vector v) { _mm_storeu_ps(data, v); }
+	CEXPR_TARGET_SSE2 static unsigned equal(vector a, vector b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+
+	// HINT: minps and maxps return their second operand unless the comparison holds, like minimum and maximum.
+	CEXPR_TARGET_SSE2 static vector apply(minimum<float>, vector a, vector b) { return _mm_min_ps(a, b); }
+	CEXPR_TARGET_SSE2 static vector apply(maximum<float>, vector a, vector b) { return _mm_max_ps(a, b); }
+	CEXPR_TARGET_SSE2 static vector apply(plus<float>, vector a, vector b) { return _mm_add_ps(a, b); }
+};
+
+struct int_ops {
+	typedef std::int32_t value_type;
+	typedef __m128i vector;
+	static const std::size_t width = 4;
+
+	CEXPR_TARGET_SSE2 static vector load(std::int32_t const* data) {
+		return _mm_loadu_si128(reinterpret_cast<__m128i const*>(data));
+	}
+	CEXPR_TARGET_SSE2 static vector splat(std::int32_t value) { return _mm_set1_epi32(value); }
+	CEXPR_TARGET_SSE2 static void store(std::int32_t* data, vector v) {
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(data), v);
+	}
+	CEXPR_TARGET_SSE2 static unsigned equal(vector a, vector b) {
+		return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b)));
+	}
+
+	// HINT: SSE2 has no pminsd/pmaxsd so select through a comparison mask.
+	CEXPR_TARGET_SSE2 static vector select(vector mask, vector a, vector b) {
+		return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+	}
+	CEXPR_TARGET_SSE2 static vector apply(minimum<std::int32_t>, vector a, vector b) {
+		return select(_mm_cmplt_epi32(a, b), a, b);
+	}
+	CEXPR_TARGET_SSE2 static vector apply(maximum<std::int32_t>, vector a, vector b) {
+		return select(_mm_cmpgt_epi32(a, b), a, b);
+	}
+	CEXPR_TARGET_SSE2 static vector apply(plus<std::int32_t>, vector a, vector b) { return _mm_add_epi32(a, b); }
+};
+
+template<class Ops>
+CEXPR_TARGET_SSE2 std::size_t find(typename Ops::value_type const* data, std::size_t n, typename Ops::value_type value) {
+	typename Ops::vector const needle = Ops::splat(value);
+	std::size_t pos = 0;
+	for (; pos + Ops::width <= n; pos += Ops::width) {
+		unsigned const mask = Ops::equal(Ops::load(data + pos), needle);
+		if (mask != 0)
+			return pos + __builtin_ctz(mask);
+	}
+	return detail::find(data, n, value, pos);
+}
+
+template<class Ops>
+CEXPR_TARGET_SSE2 std::size_t count(typename Ops::value_type const* data, std::size_t n, typename Ops::value_type value) {
+	typename Ops::vector const needle = Ops::splat(value);
+	std::size_t result = 0;
+	std::size_t pos = 0;
+	for (; pos + Ops::width <= n; pos += Ops::width)
+		result += __builtin_popcount(Ops::equal(Ops::load(data + pos), needle));
+	return result + detail::count(data, n, value, pos);
+}
+
+template<class Ops, class Operation>
+CEXPR_TARGET_SSE2 typename Ops::value_type reduce(typename Ops::value_type const* data, std::size_t n, Operation op) {
+	static const std::size_t vectors = reduce_lanes / Ops::width;
+	if (n < reduce_lanes)
+		return detail::reduce(data, n, op);
+
+	typename Ops::vector acc[vectors];
+	for (std::size_t v = 0; v < vectors; ++v)
+		acc[v] = Ops::load(data + v * Ops::width);
+	std::size_t pos = reduce_lanes;
+	for (; pos + reduce_lanes <= n; pos += reduce_lanes)
+		for (std::size_t v = 0; v < vectors; ++v)
+			acc[v] = Ops::apply(op, acc[v], Ops::load(data + pos + v * Ops::width));
+
+	typename Ops::value_type lanes[reduce_lanes];
+	for (std::size_t v = 0; v < vectors; ++v)
+		Ops::store(lanes + v * Ops::width, acc[v]);
+	reduce_into(lanes, data, n, pos, op);
+	return combine(lanes, n, op);
+}
+
+}
+
+namespace avx2 {
+
+struct float_ops {
+	typedef float value_type;
+	typedef __m256 vector;
+	static const std::size_t width = 8;
+
+	CEXPR_TARGET_AVX2 static vector load(float const* data) { return _mm256_loadu_ps(data); }
+	CEXPR_TARGET_AVX2 static vector splat(float value) { return _mm256_set1_ps(value); }
+	CEXPR_TARGET_AVX2 static void store(float* data, vector v) { _mm256_storeu_ps(data, v); }
+	CEXPR_TARGET_AVX2 static unsigned equal(vector a, vector b) {
+		return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ));
+	}
+
+	CEXPR_TARGET_AVX2 static vector apply(minimum<float>, vector a, vector b) { return _mm256_min_ps(a, b); }
+	CEXPR_TARGET_AVX2 static vector apply(maximum<float>, vector a, vector b) { return _mm256_max_ps(a, b); }
+	CEXPR_TARGET_AVX2 static vector apply(plus<float>, vector a, vector b) { return _mm256_add_ps(a, b); }
+};
+
+struct int_ops {
+	typedef std::int32_t value_type;
+	typedef __m256i vector;
+	static const std::size_t width = 8;
+
+	CEXPR_TARGET_AVX2 static vector load(std::int32_t const* data) {
+		return _mm256_loadu_si256(reinterpret_cast<__m256i const*>(data));
+	}
+	CEXPR_TARGET_AVX2 static vector splat(std::int32_t value) { return _mm256_set1_epi32(value); }
+	CEXPR_TARGET_AVX2 static void store(std::int32_t* data, vector v) {
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(data), v);
+	}
+	CEXPR_TARGET_AVX2 static unsigned equal(vector a, vector b) {
+		return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b)));
+	}
+
+	CEXPR_TARGET_AVX2 static vector apply(minimum<std::int32_t>, vector a, vector b) { return _mm256_min_epi32(a, b); }
+	CEXPR_TARGET_AVX2 static vector apply(maximum<std::int32_t>, vector a, vector b) { return _mm256_max_epi32(a, b); }
+	CEXPR_TARGET_AVX2 static vector apply(plus<std::int32_t>, vector a, vector b) { return _mm256_add_epi32(a, b); }
+};
+
+template<class Ops>
+CEXPR_TARGET_AVX2 std::size_t find(typename Ops::value_type const* data, std::size_t n, typename Ops::value_type value) {
+	typename Ops::vector const needle = Ops::splat(value);
+	std::size_t pos = 0;
+	for (; pos + Ops::width <= n; pos += Ops::width) {
+		unsigned const mask = Ops::equal(Ops::load(data + pos), needle);
+		if (mask != 0)
+			return pos + __builtin_ctz(mask);
+	}
+	return detail::find(data, n, value, pos);
+}
+
+template<class Ops>
+CEXPR_TARGET_AVX2 std::size_t count(typename Ops::value_type const* data, std::size_t n, typename Ops::value_type value) {
+	typename Ops::vector const needle = Ops::splat(value);
+	std::size_t result = 0;
+	std::size_t pos = 0;
+	for (; pos + Ops::width <= n; pos += Ops::width)
+		result += __builtin_popcount(Ops::equal(Ops::load(data + pos), needle));
+	return result + detail::count(data, n, value, pos);
+}
+
+// HINT: One register holds all reduce_lanes accumulators.
+template<class Ops, class Operation>
+CEXPR_TARGET_AVX2 typename Ops::value_type reduce(typename Ops::value_type const* data, std::size_t n, Operation op) {
+	static_assert(Ops::width == reduce_lanes, "one vector per reduction");
+	if (n < reduce_lanes)
+		return detail::reduce(data, n, op);
+
+	typename Ops::vector acc = Ops::load(data);
+	std::size_t pos = reduce_lanes;
+	for (; pos + reduce_lanes <= n; pos += reduce_lanes)
+		acc = Ops::apply(op, acc, Ops::load(data + pos));
+
+	typename Ops::value_type lanes[reduce_lanes];
+	Ops::store(lanes, acc);
+	reduce_into(lanes, data, n, pos, op);
+	return combine(lanes, n, op);
+}
+
+}
+
+#undef CEXPR_TARGET_SSE2
+#undef CEXPR_TARGET_AVX2
+
+#endif
+
+//! Selects the vector operations for \p T.
+//! \details \c sse2 and \c avx2 are \c void when there are no kernels for \p T.
+template<typename T>
+struct kernels {
+	typedef void sse2;
+	typedef void avx2;
+};
+
+#ifdef CEXPR_RUNTIME_X86_64
+template<>
+struct kernels<float> {
+	typedef sse2::float_ops sse2;
+	typedef avx2::float_ops avx2;
+};
+
+template<>
+struct kernels<std::int32_t> {
+	typedef sse2::int_ops sse2;
+	typedef avx2::int_ops avx2;
+};
+#endif
+
+// HINT: The T const* overloads take an explicit instruction set so that each kernel can be tested.
+
+template<typename T>
+typename std::enable_if<std::is_void<typename kernels<T>::sse2>::value, std::size_t>::type
+find(T const* data, std::size_t n, T const& value, isa) {
+	return find(data, n, value, std::size_t(0));
+}
+
+template<typename T>
+typename std::enable_if<std::is_void<typename kernels<T>::sse2>::value, std::size_t>::type
+count(T const* data, std::size_t n, T const& value, isa) {
+	return count(data, n, value, std::size_t(0));
+}
+
+template<typename T, class Operation>
+typename std::enable_if<std::is_void<typename kernels<T>::sse2>::value, T>::type
+reduce(T const* data, std::size_t n, Operation op, isa) {
+	return reduce(data, n, op);
+}
+
+#ifdef CEXPR_RUNTIME_X86_64
+template<typename T>
+typename std::enable_if<!std::is_void<typename kernels<T>::sse2>::value, std::size_t>::type
+find(T const* data, std::size_t n, T const& value, isa set) {
+	switch (set) {
+	case isa::avx2: return avx2::find<typename kernels<T>::avx2>(data, n, value);
+	case isa::sse2: return sse2::find<typename kernels<T>::sse2>(data, n, value);
+	default: return find(data, n, value, std::size_t(0));
+	}
+}
+
+template<typename T>
+typename std::enable_if<!std::is_void<typename kernels<T>::sse2>::value, std::size_t>::type
+count(T const* data, std::size_t n, T const& value, isa set) {
+	switch (set) {
+	case isa::avx2: return avx2::count<typename kernels<T>::avx2>(data, n, value);
+	case isa::sse2: return sse2::count<typename kernels<T>::sse2>(data, n, value);
+	default: return count(data, n, value, std::size_t(0));
+	}
+}
+
+template<typename T, class Operation>
+typename std::enable_if<!std::is_void<typename kernels<T>::sse2>::value, T>::type
+reduce(T const* data, std::size_t n, Operation op, isa set) {
+	switch (set) {
+	case isa::avx2: return avx2::reduce<typename kernels<T>::avx2>(data, n, op);
+	case isa::sse2: return sse2::reduce<typename kernels<T>::sse2>(data, n, op);
+	default: return reduce(data, n, op);
+	}
+}
+#endif
+
+}
+
+template<typename T, std::size_t N>
+std::size_t find(cexpr::detail::basic_list<T, N> const& list, T const& value) {
+	return detail::find(list.data(), N, value, detail::supported_isa());
+}
+
+template<typename T, std::size_t N>
+std::size_t count(cexpr::detail::basic_list<T, N> const& list, T const& value) {
+	return detail::count(list.data(), N, value, detail::supported_isa());
+}
+
+template<typename T, std::size_t N>
+T min(cexpr::detail::basic_list<T, N> const& list) {
+	static_assert(N > 0, "min of an empty list");
+	return detail::reduce(list.data(), N, detail::minimum<T>(), detail::supported_isa());
+}
+
+template<typename T, std::size_t N>
+T max(cexpr::detail::basic_list<T, N> const& list) {
+	static_assert(N > 0, "max of an empty list");
+	return detail::reduce(list.data(), N, detail::maximum<T>(), detail::supported_isa());
+}
+
+template<typename T, std::size_t N>
+T sum(cexpr::detail::basic_list<T, N> const& list) {
+	static_assert(N > 0, "sum of an empty list");
+	return detail::reduce(list.data(), N, detail::plus<T>(), detail::supported_isa());
+}
+
+}
+}
+
+#endif
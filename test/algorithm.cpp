@@ -0,0 +1,73 @@
+/*!
+ * \file algorithm.cpp
+ * \brief Unit-Tests for cexpr/algorithm.hpp.
+ * \details Assumes basic_list is functional.
+ */
+
+#include "../cexpr/algorithm.hpp"
+
+using cexpr::detail::basic_list;
+
+template<typename T, std::size_t N>
+constexpr bool equals(basic_list<T, N> const& list, T const (&values)[N], std::size_t i) {
+	return i == N
+		? true
+		: list[i] == values[i] && equals(list, values, i + 1);
+}
+
+//! Compares a basic_list<T, N> to a T[N].
+template<typename T, std::size_t N>
+constexpr bool operator==(basic_list<T, N> const& list, T const (&values)[N]) {
+	return equals(list, values, 0);
+}
+
+constexpr basic_list<int, 0> empty;
+constexpr basic_list<int, 1> one({1});
+constexpr basic_list<int, 3> three({2,3,4});
+
+// concat(basic_list<T, N> const&...)
+constexpr int concat_1[] = {2,3,4};
+static_assert(cexpr::concat(three) == concat_1, "concat 1");
+
+constexpr int concat_n[] = {1,2,3,4,1};
+static_assert(cexpr::concat(one, three, one) == concat_n, "concat n");
+
+constexpr int concat_empty[] = {2,3,4,1};
+static_assert(cexpr::concat(empty, three, empty, one, empty) == concat_empty, "concat empty");
+static_assert(cexpr::concat(empty, empty).size() == 0, "concat only empty");
+
+struct record {
+	int key;
+	int payload[8];
+};
+
+struct by_key {
+	constexpr bool operator()(record const& lhs, record const& rhs) const { return lhs.key <= rhs.key; }
+};
+
+constexpr basic_list<record, 5> records({ {3, {0}}, {1, {1}}, {4, {2}}, {1, {3}}, {0, {4}} });
+
+// sort_indices(basic_list<T, N> const&, Compare)
+static_assert(cexpr::sort_indices(basic_list<record, 0>(), by_key()).size() == 0, "sort_indices empty");
+
+constexpr std::size_t sort_indices_1[] = {0};
+static_assert(cexpr::sort_indices(basic_list<record, 1>(records), by_key()) == sort_indices_1, "sort_indices 1");
+
+constexpr std::size_t sort_indices_n[] = {4,1,3,0,2};
+static_assert(cexpr::sort_indices(records, by_key()) == sort_indices_n, "sort_indices n");
+
+constexpr unsigned char sort_indices_narrow[] = {4,1,3,0,2};
+static_assert(cexpr::sort_indices<unsigned char>(records, by_key()) == sort_indices_narrow, "sort_indices narrow");
+
+// apply_permutation(basic_list<T, N> const&, basic_list<Index, N> const&)
+constexpr auto sorted_records = cexpr::apply_permutation(records, cexpr::sort_indices<unsigned char>(records, by_key()));
+static_assert(sorted_records[0].payload[0] == 4, "apply_permutation [0]");
+static_assert(sorted_records[1].payload[0] == 1, "apply_permutation [1]");
+static_assert(sorted_records[2].payload[0] == 3, "apply_permutation [2]");
+static_assert(sorted_records[3].payload[0] == 0, "apply_permutation [3]");
+static_assert(sorted_records[4].payload[0] == 2, "apply_permutation [4]");
+
+constexpr int apply_permutation_repeat[] = {4,4,2};
+static_assert(cexpr::apply_permutation(three, basic_list<int, 3>({2,2,0})) == apply_permutation_repeat, "apply_permutation repeat");
+
+int main() {}
@@ -0,0 +1,86 @@
+/*!
+ * \file compressed_table.cpp
+ * \brief Unit-Tests for cexpr::block_table and cexpr::run_table.
+ * \details Assumes basic_list and basic_tree are functional.
+ */
+
+#include <cmath>
+#include "../cexpr/compressed_table.hpp"
+
+#define STATIC_ASSERT_EQUALS(value, expected) static_assert(value == expected, #value " != " #expected)
+
+//! A test that should fail at compile time.
+// TODO: Create a unit test framework that ensures the FAILs fail.
+#ifndef FAIL
+#define FAIL(...)
+#endif
+
+using cexpr::detail::basic_list;
+
+constexpr basic_list<int, 14> list{1,1,1,1, 2,2,3,3, 1,1,1,1, 2,2};
+
+// unique_blocks<B>(basic_list<T, N> const&)
+STATIC_ASSERT_EQUALS(cexpr::unique_blocks<4>(list), 2);
+STATIC_ASSERT_EQUALS(cexpr::unique_blocks<2>(list), 3);
+STATIC_ASSERT_EQUALS(cexpr::unique_blocks<1>(list), 3);
+STATIC_ASSERT_EQUALS(cexpr::unique_blocks<16>(list), 1);
+STATIC_ASSERT_EQUALS(cexpr::unique_blocks<4>(basic_list<int, 0>()), 0);
+
+// count_runs(basic_list<T, N> const&)
+STATIC_ASSERT_EQUALS(cexpr::count_runs(list), 5);
+STATIC_ASSERT_EQUALS(cexpr::count_runs(basic_list<int, 3>(7)), 1);
+STATIC_ASSERT_EQUALS(cexpr::count_runs(basic_list<int, 0>()), 0);
+
+// block_table(basic_list<T, N> const&)
+constexpr cexpr::block_table<int, 14, 4, 2, unsigned char> blocks(list);
+STATIC_ASSERT_EQUALS(blocks.block_count, 4);
+FAIL(constexpr cexpr::block_table<int, 14, 4, 3> wrong_unique(list);)
+
+// block_table::operator[](size_type)
+STATIC_ASSERT_EQUALS(blocks[0], 1);
+STATIC_ASSERT_EQUALS(blocks[5], 2);
+STATIC_ASSERT_EQUALS(blocks[6], 3);
+STATIC_ASSERT_EQUALS(blocks[11], 1);
+STATIC_ASSERT_EQUALS(blocks[12], 2);
+STATIC_ASSERT_EQUALS(blocks[13], 2);
+FAIL(constexpr int block_oob = blocks[14];)
+
+// run_table(basic_list<T, N> const&)
+constexpr cexpr::run_table<int, 14, 5, 3, unsigned char> runs(list);
+STATIC_ASSERT_EQUALS(runs.sample_count, 5);
+FAIL(constexpr cexpr::run_table<int, 14, 4> wrong_runs(list);)
+
+// run_table::operator[](size_type)
+STATIC_ASSERT_EQUALS(runs[0], 1);
+STATIC_ASSERT_EQUALS(runs[4], 2);
+STATIC_ASSERT_EQUALS(runs[7], 3);
+STATIC_ASSERT_EQUALS(runs[8], 1);
+STATIC_ASSERT_EQUALS(runs[13], 2);
+FAIL(constexpr int run_oob = runs[14];)
+
+// Signed zeros are kept apart.
+constexpr basic_list<float, 4> zeros{0.0f, -0.0f, 1.0f, -0.0f};
+STATIC_ASSERT_EQUALS(cexpr::unique_blocks<1>(zeros), 3);
+STATIC_ASSERT_EQUALS(cexpr::count_runs(zeros), 4);
+constexpr cexpr::block_table<float, 4, 1, 3> zero_blocks(zeros);
+constexpr cexpr::run_table<float, 4, 4, 2> zero_runs(zeros);
+
+int main() {
+	// lookup(size_type) and operator[](size_type) keep the sign of zero
+	for (std::size_t pos = 0; pos < zeros.size(); ++pos)
+		if (std::signbit(zero_blocks.lookup(pos)) != std::signbit(zeros[pos])
+		    || std::signbit(zero_runs.lookup(pos)) != std::signbit(zeros[pos])
+		    || std::signbit(zero_blocks[pos]) != std::signbit(zeros[pos])
+		    || std::signbit(zero_runs[pos]) != std::signbit(zeros[pos]))
+			return 1;
+
+	// lookup(size_type)
+	for (std::size_t pos = 0; pos < list.size(); ++pos)
+		if (blocks.lookup(pos) != list[pos] || runs.lookup(pos) != list[pos])
+			return 1;
+
+	// index_data(), block_data(), start_data(), value_data(), sample_data()
+	return blocks.index_data()[3] == 1 && blocks.block_data()[5] == 2
+	    && runs.start_data()[2] == 6 && runs.value_data()[2] == 3 && runs.sample_data()[3] == 3
+		? 0 : 1;
+}
@@ -0,0 +1,78 @@
+/*!
+ * \file cost.cpp
+ * \brief Unit-Tests for cexpr::costs.
+ * \details The expected figures are the hand-derived upper bounds of cexpr/cost.hpp, not measurements.
+ * GCC evaluates each operation within the asserted depth, needing for example 20 rather than 21 for
+ * sort<8> and 16 rather than 18 for set<8>.  The steps figures are not checked against any compiler.
+ */
+
+#include "../cexpr/cost.hpp"
+#include "../cexpr/grid.hpp"
+#include "../cexpr/priority_queue.hpp"
+
+#define STATIC_ASSERT_EQUALS(value, expected) static_assert(value == expected, #value " != " #expected)
+
+using cexpr::detail::basic_list;
+
+template<std::size_t N>
+using costs = cexpr::costs<basic_list<int, N>>;
+
+// within(cost, size_type, size_type)
+static_assert(cexpr::within({ 2, 3 }, 2, 3), "within exact");
+static_assert(!cexpr::within({ 3, 3 }, 2, 3), "within depth");
+static_assert(!cexpr::within({ 2, 4 }, 2, 3), "within steps");
+
+// construct()
+STATIC_ASSERT_EQUALS(costs<0>::construct().depth, 1);
+STATIC_ASSERT_EQUALS(costs<8>::construct().depth, 9);
+
+// copy<M>()
+STATIC_ASSERT_EQUALS(costs<8>::copy<8>().depth, 18);
+STATIC_ASSERT_EQUALS(costs<4>::copy<8>().depth, 14);
+
+// set(), insert(), insert_range(), erase()
+STATIC_ASSERT_EQUALS(costs<8>::set().depth, 18);
+STATIC_ASSERT_EQUALS(costs<8>::insert().depth, 18);
+STATIC_ASSERT_EQUALS(costs<8>::insert_range().depth, 22);
+STATIC_ASSERT_EQUALS(costs<8>::erase().depth, 21);
+
+// concat<K, M>()
+STATIC_ASSERT_EQUALS((costs<96>::concat<3, 32>().depth), 134);
+
+// merge()
+STATIC_ASSERT_EQUALS(costs<2>::merge().depth, 7);
+STATIC_ASSERT_EQUALS(costs<16>::merge().depth, 35);
+
+// sort()
+STATIC_ASSERT_EQUALS(costs<1>::sort().depth, 1);
+STATIC_ASSERT_EQUALS(costs<2>::sort().depth, 9);
+STATIC_ASSERT_EQUALS(costs<8>::sort().depth, 21);
+static_assert(costs<8>::sort().steps < costs<9>::sort().steps, "sort steps grow with N");
+
+// sort_indices(), apply_permutation()
+STATIC_ASSERT_EQUALS(costs<1>::sort_indices().depth, 6);
+STATIC_ASSERT_EQUALS(costs<32>::sort_indices().depth, 71);
+STATIC_ASSERT_EQUALS(costs<32>::apply_permutation().depth, 67);
+
+// priority_queue
+struct less {
+	constexpr bool operator()(int lhs, int rhs) const { return lhs < rhs; }
+};
+
+STATIC_ASSERT_EQUALS((cexpr::costs<cexpr::priority_queue<int, 64, less>>::push().depth), 16);
+STATIC_ASSERT_EQUALS((cexpr::costs<cexpr::priority_queue<int, 64, less>>::pop().depth), 21);
+STATIC_ASSERT_EQUALS((cexpr::costs<cexpr::priority_queue<int, 64, less>>::heapify().depth), 74);
+static_assert(cexpr::costs<cexpr::priority_queue<int, 64, less>>::pop().steps
+              < cexpr::costs<basic_list<int, 64>>::erase().steps, "pop is cheaper than erase(0)");
+
+// grid
+STATIC_ASSERT_EQUALS((cexpr::costs<cexpr::grid<int, 64, 64>>::generate().depth), 17);
+STATIC_ASSERT_EQUALS((cexpr::costs<cexpr::grid<int, 4, 4, cexpr::tiled<8, 8>>>::generate().depth), 11);
+STATIC_ASSERT_EQUALS((cexpr::costs<cexpr::grid<int, 64, 32>>::at().depth), 13);
+STATIC_ASSERT_EQUALS((cexpr::costs<cexpr::grid<int, 64, 32>>::set().depth), 14);
+
+// C++11 only guarantees 512 nested constexpr calls.
+static_assert(cexpr::within(costs<128>::sort(), 512, -1), "sort<128> exceeds the standard depth");
+static_assert(!cexpr::within(costs<256>::sort(), 512, -1), "sort<256> within the standard depth");
+
+int main() {}
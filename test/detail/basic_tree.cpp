@@ -0,0 +1,57 @@
+/*!
+ * \file basic_tree.cpp
+ * \brief Unit-Tests for cexpr::detail::basic_tree.
+ */
+
+#include "../../cexpr/detail/basic_tree.hpp"
+
+#define STATIC_ASSERT_EQUALS(value, expected) static_assert(value == expected, #value " != " #expected)
+
+//! A test that should fail at compile time.
+// TODO: Create a unit test framework that ensures the FAILs fail.
+#ifndef FAIL
+#define FAIL(...)
+#endif
+
+using cexpr::detail::basic_tree;
+
+struct square {
+	constexpr int operator()(std::size_t pos) const { return int(pos * pos); }
+};
+
+// basic_tree<T, N>()
+STATIC_ASSERT_EQUALS((basic_tree<int, 0>().size()), 0);
+STATIC_ASSERT_EQUALS((basic_tree<int, 1>()[0]), 0);
+STATIC_ASSERT_EQUALS((basic_tree<int, 3>()[2]), 0);
+
+// basic_tree<T, N>(T const&)
+STATIC_ASSERT_EQUALS((basic_tree<int, 1>(7)[0]), 7);
+STATIC_ASSERT_EQUALS((basic_tree<int, 5>(7)[4]), 7);
+
+// basic_tree<T, N>(Generator const&, size_type)
+constexpr basic_tree<int, 5> squares(square(), 0);
+STATIC_ASSERT_EQUALS(squares[0], 0);
+STATIC_ASSERT_EQUALS(squares[1], 1);
+STATIC_ASSERT_EQUALS(squares[2], 4);
+STATIC_ASSERT_EQUALS(squares[3], 9);
+STATIC_ASSERT_EQUALS(squares[4], 16);
+STATIC_ASSERT_EQUALS((basic_tree<int, 2>(square(), 3)[1]), 16);
+
+// operator[](size_type)
+FAIL(constexpr int index_oob_0 = basic_tree<int, 0>()[0];)
+FAIL(constexpr int index_oob_1 = basic_tree<int, 1>()[1];)
+FAIL(constexpr int index_oob_n = squares[5];)
+
+// set(size_type, T const&)
+STATIC_ASSERT_EQUALS((basic_tree<int, 1>(7).set(0, 2)[0]), 2);
+STATIC_ASSERT_EQUALS(squares.set(0, -1)[0], -1);
+STATIC_ASSERT_EQUALS(squares.set(0, -1)[1], 1);
+STATIC_ASSERT_EQUALS(squares.set(3, -1)[3], -1);
+STATIC_ASSERT_EQUALS(squares.set(3, -1)[4], 16);
+FAIL(constexpr auto set_oob = squares.set(5, -1);)
+
+int main() {
+	// data()
+	int const* data = squares.data();
+	return data[0] == 0 && data[2] == 4 && data[4] == 16 ? 0 : 1;
+}
@@ -0,0 +1,97 @@
+/*!
+ * \file grid.cpp
+ * \brief Unit-Tests for cexpr::grid.
+ * \details Assumes basic_tree is functional.
+ */
+
+#include "../cexpr/grid.hpp"
+
+#define STATIC_ASSERT_EQUALS(value, expected) static_assert(value == expected, #value " != " #expected)
+
+//! A test that should fail at compile time.
+// TODO: Create a unit test framework that ensures the FAILs fail.
+#ifndef FAIL
+#define FAIL(...)
+#endif
+
+struct coordinates {
+	constexpr int operator()(std::size_t row, std::size_t column) const { return int(row * 10 + column); }
+};
+
+typedef cexpr::grid<int, 5, 3> row_major;
+typedef cexpr::grid<int, 5, 3, cexpr::tiled<2, 2>> tiled;
+
+// Layouts
+STATIC_ASSERT_EQUALS(row_major::layout_type::size, 15);
+STATIC_ASSERT_EQUALS(row_major::position(1, 2), 7);
+STATIC_ASSERT_EQUALS(tiled::layout_type::size, 24);
+STATIC_ASSERT_EQUALS(tiled::position(0, 1), 1);
+STATIC_ASSERT_EQUALS(tiled::position(1, 0), 2);
+STATIC_ASSERT_EQUALS(tiled::position(0, 2), 4);
+STATIC_ASSERT_EQUALS(tiled::position(2, 0), 12);
+STATIC_ASSERT_EQUALS(tiled::layout_type::row(13), 2);
+STATIC_ASSERT_EQUALS(tiled::layout_type::column(13), 1);
+
+// grid()
+STATIC_ASSERT_EQUALS(row_major().at(2, 4), 0);
+STATIC_ASSERT_EQUALS(row_major().width(), 5);
+STATIC_ASSERT_EQUALS(row_major().height(), 3);
+
+// grid(T const&)
+STATIC_ASSERT_EQUALS(tiled(7).at(2, 4), 7);
+
+// generate(Generator const&)
+constexpr auto generated = row_major::generate(coordinates());
+constexpr auto generated_tiled = tiled::generate(coordinates());
+STATIC_ASSERT_EQUALS(generated.at(0, 0), 0);
+STATIC_ASSERT_EQUALS(generated.at(1, 3), 13);
+STATIC_ASSERT_EQUALS(generated.at(2, 4), 24);
+STATIC_ASSERT_EQUALS(generated_tiled.at(0, 0), 0);
+STATIC_ASSERT_EQUALS(generated_tiled.at(1, 3), 13);
+STATIC_ASSERT_EQUALS(generated_tiled.at(2, 4), 24);
+
+// grid(std::initializer_list<std::initializer_list<T>>)
+constexpr row_major listed({{1,2,3}, {4}});
+STATIC_ASSERT_EQUALS(listed.at(0, 2), 3);
+STATIC_ASSERT_EQUALS(listed.at(0, 3), 0);
+STATIC_ASSERT_EQUALS(listed.at(1, 0), 4);
+STATIC_ASSERT_EQUALS(listed.at(1, 1), 0);
+STATIC_ASSERT_EQUALS(listed.at(2, 0), 0);
+FAIL(constexpr row_major too_many_rows({{1}, {2}, {3}, {4}});)
+FAIL(constexpr row_major too_many_columns({{1,2,3,4,5,6}});)
+FAIL(constexpr row_major too_many_columns_last({{1}, {2}, {1,2,3,4,5,6}});)
+
+// at(size_type, size_type)
+FAIL(constexpr int at_row_oob = generated.at(3, 0);)
+FAIL(constexpr int at_column_oob = generated.at(0, 5);)
+FAIL(constexpr int at_padding = generated_tiled.at(3, 5);)
+
+// set(size_type, size_type, T const&)
+STATIC_ASSERT_EQUALS(generated.set(1, 3, -1).at(1, 3), -1);
+STATIC_ASSERT_EQUALS(generated.set(1, 3, -1).at(1, 4), 14);
+STATIC_ASSERT_EQUALS(generated_tiled.set(2, 4, -1).at(2, 4), -1);
+STATIC_ASSERT_EQUALS(generated_tiled.set(2, 4, -1).at(2, 3), 23);
+FAIL(constexpr auto set_oob = generated.set(3, 0, -1);)
+
+// row(size_type), column(size_type)
+STATIC_ASSERT_EQUALS(generated.row(2)[1], 21);
+STATIC_ASSERT_EQUALS(generated.row(2).size(), 5);
+STATIC_ASSERT_EQUALS(generated_tiled.column(3)[2], 23);
+STATIC_ASSERT_EQUALS(generated_tiled.column(3).size(), 3);
+
+// transpose()
+STATIC_ASSERT_EQUALS(generated.transpose().at(4, 2), 24);
+STATIC_ASSERT_EQUALS(generated.transpose().width(), 3);
+STATIC_ASSERT_EQUALS(generated.transpose().height(), 5);
+STATIC_ASSERT_EQUALS(generated.transpose().row(4)[1], 14);
+STATIC_ASSERT_EQUALS(generated.transpose().column(1)[4], 14);
+
+int main() {
+	// data()
+	for (std::size_t row = 0; row < 3; ++row)
+		for (std::size_t column = 0; column < 5; ++column)
+			if (generated.data()[row_major::position(row, column)] != int(row * 10 + column)
+			    || generated_tiled.data()[tiled::position(row, column)] != int(row * 10 + column))
+				return 1;
+	return 0;
+}
@@ -0,0 +1,96 @@
+/*!
+ * \file priority_queue.cpp
+ * \brief Unit-Tests for cexpr::priority_queue.
+ * \details Assumes basic_list and basic_tree are functional.
+ */
+
+#include "../cexpr/priority_queue.hpp"
+
+//! A test that should fail at compile time.
+// TODO: Create a unit test framework that ensures the FAILs fail.
+#ifndef FAIL
+#define FAIL(...)
+#endif
+
+using cexpr::detail::basic_list;
+
+struct less {
+	constexpr bool operator()(int lhs, int rhs) const { return lhs < rhs; }
+};
+
+struct greater {
+	constexpr bool operator()(int lhs, int rhs) const { return lhs > rhs; }
+};
+
+typedef cexpr::priority_queue<int, 8, less> max_queue;
+typedef cexpr::priority_queue<int, 8, greater> min_queue;
+
+//! Returns true if the elements of \p queue are popped in the order \p values.
+template<class Queue, std::size_t M>
+constexpr bool pops(Queue const& queue, int const (&values)[M], std::size_t i) {
+	return i == M
+		? queue.empty()
+		: !queue.empty() && queue.top() == values[i] && pops(queue.pop(), values, i + 1);
+}
+
+//! Returns true if each element of the heap in \p queue is not below its children.
+template<class Queue, class Compare>
+constexpr bool is_heap(Queue const& queue, Compare cmp, std::size_t i) {
+	return i >= queue.size()
+		? true
+		: (i == 0 || !cmp(queue.list()[(i - 1) / 2], queue.list()[i])) && is_heap(queue, cmp, i + 1);
+}
+
+// priority_queue()
+constexpr max_queue empty;
+static_assert(empty.empty(), "empty");
+static_assert(empty.size() == 0, "empty size");
+static_assert(empty.max_size() == 8, "empty max_size");
+
+// push(T const&)
+constexpr auto pushed = empty.push(5).push(1).push(9).push(3).push(7).push(9).push(0);
+static_assert(pushed.size() == 7, "push size");
+static_assert(pushed.top() == 9, "push top");
+static_assert(is_heap(pushed, less(), 0), "push heap");
+static_assert(empty.push(4).push(4).push(4).top() == 4, "push equal");
+static_assert(min_queue().push(5).push(1).push(9).top() == 1, "push min");
+
+constexpr auto full = pushed.push(2);
+static_assert(full.size() == 8, "push full");
+
+// pop()
+constexpr int pushed_order[] = {9,9,7,5,3,1,0};
+static_assert(pops(pushed, pushed_order, 0), "pop order");
+static_assert(is_heap(pushed.pop().pop(), less(), 0), "pop heap");
+
+constexpr int full_order[] = {9,9,7,5,3,2,1,0};
+static_assert(pops(full, full_order, 0), "pop full");
+
+constexpr auto large = cexpr::priority_queue<int, 256, less>().push(5).push(1).push(9).push(3);
+constexpr int large_order[] = {9,5,3,1};
+static_assert(pops(large, large_order, 0), "push pop large");
+
+// priority_queue(basic_list<T, N> const&, size_type)
+constexpr max_queue heapified(basic_list<int, 8>({4,8,1,7,3,9,2,6}));
+static_assert(is_heap(heapified, less(), 0), "heapify heap");
+constexpr int heapified_order[] = {9,8,7,6,4,3,2,1};
+static_assert(pops(heapified, heapified_order, 0), "heapify order");
+
+constexpr max_queue heapified_part(basic_list<int, 8>({4,8,1,7,3,9,2,6}), 5);
+constexpr int heapified_part_order[] = {8,7,4,3,1};
+static_assert(pops(heapified_part, heapified_part_order, 0), "heapify part");
+
+constexpr min_queue heapified_min(basic_list<int, 8>({4,8,1,7,3,9,2,6}), 8, greater());
+constexpr int heapified_min_order[] = {1,2,3,4,6,7,8,9};
+static_assert(pops(heapified_min, heapified_min_order, 0), "heapify min");
+
+// top() and pop() of an empty queue, push(T const&) of a full queue
+FAIL(constexpr int top_empty = empty.top();)
+FAIL(constexpr auto pop_empty = empty.pop();)
+FAIL(constexpr auto push_full = full.push(1);)
+
+int main() {
+	// data()
+	int const* heap = heapified.data();
+	return heap[0] == 9 ? 0 : 1;
+}
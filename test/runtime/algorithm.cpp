@@ -0,0 +1,101 @@
+/*!
+ * \file algorithm.cpp
+ * \brief Unit-Tests for cexpr::runtime algorithms.
+ * \details Every kernel supported by the processor must agree exactly with the constexpr algorithms.
+ */
+
+#include <cstdio>
+#include <cstring>
+#include "../../cexpr/algorithm.hpp"
+#include "../../cexpr/runtime/algorithm.hpp"
+
+using cexpr::detail::basic_list;
+namespace detail = cexpr::runtime::detail;
+
+static int failures = 0;
+
+//! Compares the bit patterns so that -0.0f != 0.0f.
+template<typename T>
+void expect_equals(T value, T expected, char const* what, int set) {
+	if (std::memcmp(&value, &expected, sizeof(T)) != 0) {
+		std::printf("FAIL: %s with isa %d\n", what, set);
+		++failures;
+	}
+}
+
+#define EXPECT_EQUALS(value, expected, set) expect_equals(value, expected, #value, set)
+
+//! Tests every runtime kernel on \p list against the constexpr \p find, \p count, \p min, \p max and \p sum.
+template<typename T, std::size_t N>
+void test(basic_list<T, N> const& list, T value, std::size_t find, std::size_t count, T min, T max, T sum) {
+	detail::isa const sets[] = { detail::isa::scalar, detail::isa::sse2, detail::isa::avx2 };
+	for (detail::isa set : sets) {
+		if (set > detail::supported_isa())
+			continue;
+		EXPECT_EQUALS(detail::find(list.data(), N, value, set), find, int(set));
+		EXPECT_EQUALS(detail::count(list.data(), N, value, set), count, int(set));
+		EXPECT_EQUALS(detail::reduce(list.data(), N, cexpr::detail::minimum<T>(), set), min, int(set));
+		EXPECT_EQUALS(detail::reduce(list.data(), N, cexpr::detail::maximum<T>(), set), max, int(set));
+		EXPECT_EQUALS(detail::reduce(list.data(), N, cexpr::detail::plus<T>(), set), sum, int(set));
+	}
+	EXPECT_EQUALS(cexpr::runtime::find(list, value), find, -1);
+	EXPECT_EQUALS(cexpr::runtime::count(list, value), count, -1);
+	EXPECT_EQUALS(cexpr::runtime::min(list), min, -1);
+	EXPECT_EQUALS(cexpr::runtime::max(list), max, -1);
+	EXPECT_EQUALS(cexpr::runtime::sum(list), sum, -1);
+}
+
+//! Checks that data() exposes the elements of \p list in order.
+template<typename T, std::size_t N>
+void test_data(basic_list<T, N> const& list, char const* what) {
+	for (std::size_t i = 0; i < N; ++i) {
+		if (list.data()[i] != list[i]) {
+			std::printf("FAIL: %s.data()[%zu] != %s[%zu]\n", what, i, what, i);
+			++failures;
+		}
+	}
+}
+
+//! Evaluates the expected values in constant expressions.
+#define TEST(list, value) \
+do { \
+	constexpr auto find_ = cexpr::find(list, value); \
+	constexpr auto count_ = cexpr::count(list, value); \
+	constexpr auto min_ = cexpr::min(list); \
+	constexpr auto max_ = cexpr::max(list); \
+	constexpr auto sum_ = cexpr::sum(list); \
+	test(list, value, find_, count_, min_, max_, sum_); \
+} while (false)
+
+constexpr basic_list<int, 3> ints_3({ 4, -2, 4 });
+constexpr basic_list<int, 8> ints_8({ 7, 3, -9, 3, 0, 12, 3, -1 });
+constexpr basic_list<int, 37>
+	ints_37({ 5, 1, -4, 8, 8, 0, 3, 9, -7, 2, 6, 6, 1, -3, 11, 4, 0, 8, -2, 5,
+	          7, 3, 3, 10, -6, 1, 2, 8, 0, 4, -1, 9, 6, 2, 8, -5, 3 });
+
+constexpr basic_list<float, 3> floats_3({ 0.5f, -0.0f, 0.0f });
+constexpr basic_list<float, 8> floats_8({ 0.1f, 0.7f, -0.0f, 0.0f, 1e8f, 0.3f, -1e8f, 0.1f });
+constexpr basic_list<float, 37>
+	floats_37({ 0.1f, 1e7f, 0.3f, -0.2f, 3.5f, 1e-3f, 0.0f, -0.0f, 2.25f, 0.1f, -1e7f, 0.7f, 5.5f,
+	            0.1f, 0.9f, -3.0f, 1e-7f, 0.0f, 8.0f, -0.0f, 0.3f, 0.6f, 1.1f, 0.1f, 4.4f, -2.2f,
+	            0.05f, 7e6f, 0.1f, 0.2f, -0.0f, 0.0f, 9.9f, -7e6f, 0.3f, 0.1f, 1.5f });
+
+constexpr basic_list<double, 11> doubles_11({ 0.1, 0.2, 0.3, -0.0, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 0.1 });
+
+constexpr basic_list<char, 7> chars_7({ 'a', 'b', 'c', 'd', 'e', 'f', 'g' });
+
+int main() {
+	TEST(ints_3, 4);
+	TEST(ints_8, 3);
+	TEST(ints_37, 8);
+	TEST(ints_37, 12);
+	TEST(floats_3, 0.0f);
+	TEST(floats_8, 0.1f);
+	TEST(floats_37, 0.1f);
+	TEST(floats_37, 0.4f);
+	TEST(doubles_11, 0.1);
+	test_data(chars_7, "chars_7");
+	test_data(doubles_11, "doubles_11");
+	test_data(ints_37, "ints_37");
+	return failures;
+}